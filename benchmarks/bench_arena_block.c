@@ -0,0 +1,117 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+//
+// Block arena vs malloc/free for same-sized object churn (projectiles, particles, messages).
+
+#include "arena.h"
+#include "bench_common.h"
+#include "platform.h"
+#include <stdlib.h>
+
+#define OBJECT_SIZE 48
+#define LIVE_OBJECTS 4096
+#define BURST_ROUNDS 2000
+#define CHURN_OPS (LIVE_OBJECTS * 1000)
+
+static void *g_ptrs[LIVE_OBJECTS];
+
+// Allocate a full burst, then free it in reverse (typical per-frame spawn/despawn)
+static uint64_t Bench_BurstBlock(Arena *pool) {
+  uint64_t start = Platform_GetTicksNS();
+  for (int round = 0; round < BURST_ROUNDS; ++round) {
+    for (int i = 0; i < LIVE_OBJECTS; ++i) {
+      g_ptrs[i] = Arena_Alloc(pool, OBJECT_SIZE);
+      BENCH_SINK(g_ptrs[i]);
+    }
+    for (int i = LIVE_OBJECTS - 1; i >= 0; --i) {
+      Arena_Free(pool, g_ptrs[i]);
+    }
+  }
+  return Platform_GetTicksNS() - start;
+}
+
+static uint64_t Bench_BurstMalloc(void) {
+  uint64_t start = Platform_GetTicksNS();
+  for (int round = 0; round < BURST_ROUNDS; ++round) {
+    for (int i = 0; i < LIVE_OBJECTS; ++i) {
+      g_ptrs[i] = malloc(OBJECT_SIZE);
+      BENCH_SINK(g_ptrs[i]);
+    }
+    for (int i = LIVE_OBJECTS - 1; i >= 0; --i) {
+      free(g_ptrs[i]);
+    }
+  }
+  return Platform_GetTicksNS() - start;
+}
+
+// Random replacement within a live set (objects dying out of order)
+static uint64_t Bench_ChurnBlock(Arena *pool) {
+  uint32_t rng = 0x9E3779B9u;
+  for (int i = 0; i < LIVE_OBJECTS; ++i) {
+    g_ptrs[i] = Arena_Alloc(pool, OBJECT_SIZE);
+  }
+
+  uint64_t start = Platform_GetTicksNS();
+  for (int op = 0; op < CHURN_OPS; ++op) {
+    uint32_t slot = Bench_Random(&rng) % LIVE_OBJECTS;
+    Arena_Free(pool, g_ptrs[slot]);
+    g_ptrs[slot] = Arena_Alloc(pool, OBJECT_SIZE);
+    BENCH_SINK(g_ptrs[slot]);
+  }
+  uint64_t elapsed = Platform_GetTicksNS() - start;
+
+  Arena_Reset(pool);
+  return elapsed;
+}
+
+static uint64_t Bench_ChurnMalloc(void) {
+  uint32_t rng = 0x9E3779B9u;
+  for (int i = 0; i < LIVE_OBJECTS; ++i) {
+    g_ptrs[i] = malloc(OBJECT_SIZE);
+  }
+
+  uint64_t start = Platform_GetTicksNS();
+  for (int op = 0; op < CHURN_OPS; ++op) {
+    uint32_t slot = Bench_Random(&rng) % LIVE_OBJECTS;
+    free(g_ptrs[slot]);
+    g_ptrs[slot] = malloc(OBJECT_SIZE);
+    BENCH_SINK(g_ptrs[slot]);
+  }
+  uint64_t elapsed = Platform_GetTicksNS() - start;
+
+  for (int i = 0; i < LIVE_OBJECTS; ++i) {
+    free(g_ptrs[i]);
+  }
+  return elapsed;
+}
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+
+  if (!Platform_Init()) {
+    return 1;
+  }
+
+  Arena *root = Platform_GetRootArena();
+  Arena *pool = Arena_CreateBlock(root, OBJECT_SIZE, LIVE_OBJECTS, DEFAULT_ALIGNMENT);
+  Arena *pool_cl = Arena_CreateBlock(root, OBJECT_SIZE, LIVE_OBJECTS, CACHE_LINE_SIZE);
+  if (!pool || !pool_cl) {
+    Platform_Shutdown();
+    return 1;
+  }
+
+  const uint64_t burst_ops = (uint64_t)BURST_ROUNDS * LIVE_OBJECTS * 2;
+  const uint64_t churn_ops = (uint64_t)CHURN_OPS * 2;
+
+  printf("Block arena: %d-byte objects, %d live\n", OBJECT_SIZE, LIVE_OBJECTS);
+  Bench_Report("burst alloc/free: block", burst_ops, Bench_BurstBlock(pool));
+  Bench_Report("burst alloc/free: block (64B align)", burst_ops, Bench_BurstBlock(pool_cl));
+  Bench_Report("burst alloc/free: malloc", burst_ops, Bench_BurstMalloc());
+  Bench_Report("random churn: block", churn_ops, Bench_ChurnBlock(pool));
+  Bench_Report("random churn: block (64B align)", churn_ops, Bench_ChurnBlock(pool_cl));
+  Bench_Report("random churn: malloc", churn_ops, Bench_ChurnMalloc());
+
+  Platform_Shutdown();
+  return 0;
+}
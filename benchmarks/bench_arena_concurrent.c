@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+//
+// Concurrent bump arena scaling across 1..N threads, against a mutex-guarded bump arena.
+
+#include "arena.h"
+#include "bench_common.h"
+#include "platform.h"
+#include <SDL3/SDL.h>
+
+#define ALLOC_SIZE 32
+#define ALLOCS_PER_THREAD 1000000
+#define MAX_THREADS 64
+
+typedef struct BenchWorker {
+  Arena *arena;
+  SDL_Mutex *lock; // NULL = lock-free path
+  SDL_AtomicInt *start;
+} BenchWorker;
+
+static int SDLCALL Bench_WorkerMain(void *userdata) {
+  BenchWorker *worker = (BenchWorker *)userdata;
+
+  // Spin until every thread is up so we time contention, not thread startup
+  while (SDL_GetAtomicInt(worker->start) == 0) {
+  }
+
+  // Sunk once at the end: the shared sink written per allocation would be the contended line
+  uintptr_t sink = 0;
+  for (int i = 0; i < ALLOCS_PER_THREAD; ++i) {
+    void *ptr;
+    if (worker->lock) {
+      SDL_LockMutex(worker->lock);
+      ptr = Arena_Alloc(worker->arena, ALLOC_SIZE);
+      SDL_UnlockMutex(worker->lock);
+    } else {
+      ptr = Arena_Alloc(worker->arena, ALLOC_SIZE);
+    }
+    sink ^= (uintptr_t)ptr;
+  }
+  BENCH_SINK(sink);
+  return 0;
+}
+
+// Sized for one run and destroyed after it, so every run fits in the root arena's reserve
+static uint64_t Bench_Run(bool concurrent, SDL_Mutex *lock, int thread_count) {
+  SDL_Thread *threads[MAX_THREADS];
+  BenchWorker workers[MAX_THREADS];
+  SDL_AtomicInt start;
+  SDL_SetAtomicInt(&start, 0);
+
+  Arena *root = Platform_GetRootArena();
+  size_t arena_size = (size_t)thread_count * ALLOCS_PER_THREAD * ALLOC_SIZE;
+  Arena *arena = concurrent ? Arena_CreateConcurrentBump(root, arena_size, DEFAULT_ALIGNMENT)
+                            : Arena_CreateBump(root, arena_size, DEFAULT_ALIGNMENT);
+  if (!arena) {
+    return 0;
+  }
+
+  for (int t = 0; t < thread_count; ++t) {
+    workers[t] = (BenchWorker){.arena = arena, .lock = concurrent ? NULL : lock, .start = &start};
+    threads[t] = SDL_CreateThread(Bench_WorkerMain, "bench_worker", &workers[t]);
+  }
+
+  uint64_t begin = Platform_GetTicksNS();
+  SDL_SetAtomicInt(&start, 1);
+  for (int t = 0; t < thread_count; ++t) {
+    SDL_WaitThread(threads[t], NULL);
+  }
+  uint64_t elapsed = Platform_GetTicksNS() - begin;
+
+  Arena_Destroy(arena);
+  return elapsed;
+}
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+
+  if (!Platform_Init()) {
+    return 1;
+  }
+
+  int max_threads = SDL_GetNumLogicalCPUCores();
+  if (max_threads > MAX_THREADS) {
+    max_threads = MAX_THREADS;
+  }
+
+  SDL_Mutex *lock = SDL_CreateMutex();
+  if (!lock) {
+    Platform_Shutdown();
+    return 1;
+  }
+
+  printf("Concurrent bump arena: %d-byte allocs, %d per thread\n", ALLOC_SIZE, ALLOCS_PER_THREAD);
+  // Doubling, with the last step clamped to the core count when that isn't a power of two
+  for (int threads = 1;; threads = threads * 2 < max_threads ? threads * 2 : max_threads) {
+    char name[64];
+    uint64_t ops = (uint64_t)threads * ALLOCS_PER_THREAD;
+
+    uint64_t shared_ns = Bench_Run(true, lock, threads);
+    uint64_t locked_ns = Bench_Run(false, lock, threads);
+    if (!shared_ns || !locked_ns) {
+      printf("%2d threads: couldn't create the arenas\n", threads);
+      break;
+    }
+
+    snprintf(name, sizeof(name), "%2d threads: atomic fetch-add", threads);
+    Bench_Report(name, ops, shared_ns);
+
+    snprintf(name, sizeof(name), "%2d threads: mutex + bump", threads);
+    Bench_Report(name, ops, locked_ns);
+
+    if (threads >= max_threads)
+      break;
+  }
+
+  SDL_DestroyMutex(lock);
+  Platform_Shutdown();
+  return 0;
+}
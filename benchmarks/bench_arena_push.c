@@ -0,0 +1,139 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+//
+// Inline Arena_BumpPush/Arena_StackPush vs the generic Arena_AllocAligned path
+// (per-frame transient allocations: command buffers, temp arrays, strings), and a check that
+// an ArenaArray / ArenaString alone in its arena grows in place.
+
+#include "arena.h"
+#include "arena_array.h"
+#include "bench_common.h"
+#include "platform.h"
+
+#define FRAME_ALLOCS 100000
+#define FRAMES 200
+#define SMALL_SIZE 24
+#define ARENA_SIZE MEGABYTES(8)
+#define GROWTH_ELEMENTS 4096
+
+// Mixed sizes with a fixed pattern so both paths do identical work
+static size_t Bench_Size(int i) {
+  return SMALL_SIZE + (size_t)(i & 7) * 8;
+}
+
+static uint64_t Bench_Generic(Arena *arena) {
+  uint64_t start = Platform_GetTicksNS();
+  for (int frame = 0; frame < FRAMES; ++frame) {
+    for (int i = 0; i < FRAME_ALLOCS; ++i) {
+      BENCH_SINK(Arena_AllocAligned(arena, Bench_Size(i), DEFAULT_ALIGNMENT));
+    }
+    Arena_Reset(arena);
+  }
+  return Platform_GetTicksNS() - start;
+}
+
+static uint64_t Bench_BumpInline(Arena *arena) {
+  uint64_t start = Platform_GetTicksNS();
+  for (int frame = 0; frame < FRAMES; ++frame) {
+    for (int i = 0; i < FRAME_ALLOCS; ++i) {
+      BENCH_SINK(Arena_BumpPush(arena, Bench_Size(i), DEFAULT_ALIGNMENT));
+    }
+    Arena_Reset(arena);
+  }
+  return Platform_GetTicksNS() - start;
+}
+
+static uint64_t Bench_StackInline(Arena *arena) {
+  uint64_t start = Platform_GetTicksNS();
+  for (int frame = 0; frame < FRAMES; ++frame) {
+    ArenaMarker mark = Arena_Mark(arena);
+    for (int i = 0; i < FRAME_ALLOCS; ++i) {
+      BENCH_SINK(Arena_StackPush(arena, Bench_Size(i), DEFAULT_ALIGNMENT));
+    }
+    Arena_PopTo(arena, mark);
+  }
+  return Platform_GetTicksNS() - start;
+}
+
+// Pushes runs of 1..8 elements (so growth usually happens with spare capacity left); the array
+// is the arena's only allocation, so every growth should extend in place. Returns the number of
+// times the storage moved.
+static int Bench_ArrayMoves(Arena *arena) {
+  Arena_Reset(arena);
+  ArenaArray array = ArenaArray_Init(arena, uint32_t, 0);
+  int moves = 0;
+  void *data = NULL;
+  for (uint32_t i = 0; array.count < GROWTH_ELEMENTS; ++i) {
+    const size_t run = 1 + (i & 7);
+    uint32_t *slots = ArenaArray_PushN(&array, run);
+    if (!slots)
+      return -1;
+    for (size_t j = 0; j < run; ++j) {
+      slots[j] = i;
+    }
+    if (data && array.data != data)
+      ++moves;
+    data = array.data;
+  }
+  return moves;
+}
+
+static int Bench_StringMoves(Arena *arena) {
+  Arena_Reset(arena);
+  ArenaString string = ArenaString_Create(arena, 0);
+  int moves = 0;
+  char *data = string.data;
+  for (int i = 0; i < GROWTH_ELEMENTS; ++i) {
+    if (!ArenaString_AppendCStr(&string, "0123456789"))
+      return -1;
+    if (string.data != data)
+      ++moves;
+    data = string.data;
+  }
+  return moves;
+}
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+
+  if (!Platform_Init()) {
+    return 1;
+  }
+
+  Arena *root = Platform_GetRootArena();
+  Arena *bump = Arena_CreateBump(root, ARENA_SIZE, DEFAULT_ALIGNMENT);
+  Arena *stack = Arena_CreateStack(root, ARENA_SIZE, DEFAULT_ALIGNMENT);
+  if (!bump || !stack) {
+    Platform_Shutdown();
+    return 1;
+  }
+
+  const uint64_t ops = (uint64_t)FRAMES * FRAME_ALLOCS;
+
+  printf("Arena push: %d allocations/frame, %d frames\n", FRAME_ALLOCS, FRAMES);
+  Bench_Report("bump: Arena_AllocAligned", ops, Bench_Generic(bump));
+  Bench_Report("bump: Arena_BumpPush", ops, Bench_BumpInline(bump));
+  Bench_Report("stack: Arena_AllocAligned", ops, Bench_Generic(stack));
+  Bench_Report("stack: Arena_StackPush", ops, Bench_StackInline(stack));
+  printf("  peak used: bump %zu KB, stack %zu KB\n",
+         Arena_GetPeakUsed(bump) / 1024, Arena_GetPeakUsed(stack) / 1024);
+
+  // Growth copying would show up as moves and as more used than the data needs
+  const int array_moves = Bench_ArrayMoves(bump);
+  const size_t array_used = Arena_GetUsed(bump);
+  const int string_moves = Bench_StringMoves(bump);
+  const size_t string_used = Arena_GetUsed(bump);
+  printf("  lone array growth: %d moves, %zu KB used for %zu KB\n",
+         array_moves, array_used / 1024, GROWTH_ELEMENTS * sizeof(uint32_t) / 1024);
+  printf("  lone string growth: %d moves, %zu KB used for %d KB\n",
+         string_moves, string_used / 1024, GROWTH_ELEMENTS * 10 / 1024);
+  if (array_moves != 0 || string_moves != 0) {
+    printf("  FAILED: a lone ArenaArray/ArenaString moved while growing\n");
+    Platform_Shutdown();
+    return 1;
+  }
+
+  Platform_Shutdown();
+  return 0;
+}
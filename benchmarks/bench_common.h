@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#ifndef FLIGHT_BENCH_COMMON_H
+#define FLIGHT_BENCH_COMMON_H
+
+#include "platform.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Results go straight to stdout: Platform_Log compiles out of Release builds,
+// which are the only builds worth benchmarking.
+static inline void Bench_Report(const char *name, uint64_t ops, uint64_t elapsed_ns) {
+  if (ops == 0 || elapsed_ns == 0) {
+    printf("  %-36s (no samples)\n", name);
+    return;
+  }
+  printf("  %-36s %9.2f ns/op %10.2f Mops/s\n",
+         name,
+         (double)elapsed_ns / (double)ops,
+         (double)ops * 1000.0 / (double)elapsed_ns);
+}
+
+// Keeps the optimizer from discarding the work we're timing
+static volatile uintptr_t g_bench_sink;
+#define BENCH_SINK(value) (g_bench_sink ^= (uintptr_t)(value))
+
+// Small deterministic PRNG so runs are comparable (xorshift32)
+static inline uint32_t Bench_Random(uint32_t *state) {
+  uint32_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
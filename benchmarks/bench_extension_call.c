@@ -0,0 +1,122 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+//
+// Cost of one extension call from hot-reload game code: the old per-call name lookup,
+// a per-call ID lookup, the generated ExtensionAPICache macro, and a plain function pointer.
+// Every variant calls the job system's GetThreadIndex, a near-empty function.
+
+// Compile the hot-reload macros a game plugin sees, so the cached variant runs the generated code
+#define ENABLE_GAME_AS_PLUGIN
+
+#include "bench_common.h"
+#include "engine_api.h"
+#include "extension.h"
+#include "jobs_extension_api.h"
+#include "platform.h"
+#include "plugin_api.h"
+#include "plugin_macros.h"
+
+#define CALLS 20000000
+
+// Forward declaration (function defined in engine.c)
+void Engine_RegisterExtension(ExtensionInterface *ext);
+
+extern ExtensionInterface g_extension_jobs;
+
+// Stands in for the game plugin the macros normally expand inside
+static PluginAPI g_bench_plugin;
+
+DEFINE_PLUGIN_API_ACCESSORS(g_bench_plugin);
+
+// Registered ahead of "Jobs" so the name scan does the same work it would in a real build
+static ExtensionInterface g_other_extensions[] = {
+    {.name = "Input"},
+    {.name = "Renderer2D"},
+    {.name = "Audio"},
+    {.name = "Physics"},
+    {.name = "Assets"},
+    {.name = "Network"},
+    {.name = "UI"},
+};
+
+static uint64_t Bench_NameLookup(EngineAPI *engine) {
+  uint32_t value = 0;
+  uint64_t start = Platform_GetTicksNS();
+  for (int i = 0; i < CALLS; ++i) {
+    value += ((JobsAPI *)engine->GetExtensionAPI("Jobs"))->GetThreadIndex();
+  }
+  uint64_t elapsed = Platform_GetTicksNS() - start;
+  BENCH_SINK(value);
+  return elapsed;
+}
+
+static uint64_t Bench_IDLookup(EngineAPI *engine, ExtensionID id) {
+  uint32_t value = 0;
+  uint64_t start = Platform_GetTicksNS();
+  for (int i = 0; i < CALLS; ++i) {
+    value += ((JobsAPI *)engine->GetExtensionAPIByID(id))->GetThreadIndex();
+  }
+  uint64_t elapsed = Platform_GetTicksNS() - start;
+  BENCH_SINK(value);
+  return elapsed;
+}
+
+static uint64_t Bench_CachedMacro(void) {
+  uint32_t value = 0;
+  uint64_t start = Platform_GetTicksNS();
+  for (int i = 0; i < CALLS; ++i) {
+    value += JOBS_GET_THREAD_INDEX();
+  }
+  uint64_t elapsed = Platform_GetTicksNS() - start;
+  BENCH_SINK(value);
+  return elapsed;
+}
+
+static uint64_t Bench_FunctionPointer(uint32_t (*get_thread_index)(void)) {
+  uint32_t value = 0;
+  uint64_t start = Platform_GetTicksNS();
+  for (int i = 0; i < CALLS; ++i) {
+    value += get_thread_index();
+  }
+  uint64_t elapsed = Platform_GetTicksNS() - start;
+  BENCH_SINK(value);
+  return elapsed;
+}
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+
+  if (!Platform_Init()) {
+    return 1;
+  }
+
+  for (size_t i = 0; i < sizeof(g_other_extensions) / sizeof(g_other_extensions[0]); ++i) {
+    Engine_RegisterExtension(&g_other_extensions[i]);
+  }
+  Engine_RegisterExtension(&g_extension_jobs);
+
+  EngineAPI *engine = Engine_GetAPI();
+  g_bench_plugin.platform = Platform_GetAPI();
+  g_bench_plugin.engine = engine;
+  __plugin_resolve_extensions(engine);
+
+  // The first call fetches the slot (initialising the job system); no job threads are needed
+  ExtensionID id = engine->GetExtensionID("Jobs");
+  if (id == EXTENSION_ID_INVALID || !ExtensionAPICache_GetJobs(__extension_api())) {
+    Platform_Shutdown();
+    return 1;
+  }
+  JOBS_SET_WORKER_COUNT(0);
+  JobsAPI *api = (JobsAPI *)engine->GetExtensionAPIByID(id);
+
+  printf("Extension call: %d calls, target registered last of %u extensions\n", CALLS, id + 1);
+  Bench_Report("name lookup per call (old macros)", CALLS, Bench_NameLookup(engine));
+  Bench_Report("ID lookup per call", CALLS, Bench_IDLookup(engine, id));
+  Bench_Report("cached slot (generated macros)", CALLS, Bench_CachedMacro());
+  Bench_Report("plain function pointer", CALLS, Bench_FunctionPointer(api->GetThreadIndex));
+
+  g_extension_jobs.Shutdown();
+  Platform_Shutdown();
+  return 0;
+}
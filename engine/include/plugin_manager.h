@@ -4,12 +4,16 @@
 #ifndef PLUGIN_MANAGER_H
 #define PLUGIN_MANAGER_H
 
+#include "arena_types.h"
 #include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+  // One frame's render data, built by PluginManager_SnapshotAll
+  typedef struct PluginRenderFrame PluginRenderFrame;
+
   // Initialize plugin system
   bool PluginManager_Init(void);
 
@@ -22,14 +26,25 @@ extern "C" {
   // Unload a specific plugin
   void PluginManager_Unload(int plugin_index);
 
-  // Update all loaded plugins
+  // Update all loaded plugins, running independent ones concurrently on the worker pool
+  // (see PluginAPI.update_reads/update_writes)
   void PluginManager_UpdateAll(float delta_time);
 
   // Render all loaded plugins
   void PluginManager_RenderAll(void);
 
-  // Check and reload any plugins that changed
-  void PluginManager_CheckReloadAll(void);
+  // Pipelined frames: copy every plugin's render data into frame_arena (after the frame's updates)
+  // and draw it later with PluginManager_RenderSnapshotAll, while the next updates run.
+  // Only valid while PluginManager_CanPipeline holds; NULL if frame_arena ran out.
+  PluginRenderFrame* PluginManager_SnapshotAll(Arena* frame_arena);
+  void PluginManager_RenderSnapshotAll(const PluginRenderFrame* frame);
+
+  // True if every active plugin has snapshot and render_snapshot
+  bool PluginManager_CanPipeline(void);
+
+  // Check and reload any plugins that changed. Returns true if any plugin was swapped to a new
+  // build (or restarted), which invalidates snapshots taken before the call.
+  bool PluginManager_CheckReloadAll(void);
 
   // Get number of loaded plugins
   int PluginManager_GetCount(void);
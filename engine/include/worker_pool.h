@@ -0,0 +1,36 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  // One task of a batch: index runs 0..count-1
+  typedef void (*WorkerPoolTask)(void* data, uint32_t index);
+
+  // Start worker_count threads (0 = half the CPU cores beyond the calling thread, leaving the rest
+  // to the job system)
+  bool WorkerPool_Init(uint32_t worker_count);
+
+  // Stop and join the workers
+  void WorkerPool_Shutdown(void);
+
+  // Worker threads running (0 before init, or on a single-core machine)
+  uint32_t WorkerPool_GetWorkerCount(void);
+
+  // Run task(data, 0..count-1) across the workers and the calling thread, returning once every
+  // index has finished. Indices are claimed in order but may finish in any order. Runs inline
+  // when there are no workers. Not reentrant: call from one thread, not from inside a task.
+  void WorkerPool_Run(WorkerPoolTask task, void* data, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -2,85 +2,461 @@
 // All rights reserved.
 
 #include "engine.h"
+#include "arena.h"
 #include "engine_api.h"
 #include "extension.h"
+#include "extension_manifest_generated.h"
 #include "platform.h"
 #include "platform_api.h"
+#include "platform_atomic.h"
+#include "platform_thread.h"
+#include "worker_pool.h"
 #include <stdlib.h>
 #include <string.h>
 
-// TODO: (ARC) Make this a dynamic array or size to the exact number of extensions we have (should be known at compile time)?
-#define MAX_EXTENSIONS 32
-static ExtensionInterface* g_extensions[MAX_EXTENSIONS];
+#ifdef ENABLE_GAME_AS_PLUGIN
+    // Hot reload build - use plugin system
+    #include "plugin_manager.h"
+#else
+    // Static build - direct link to game
+    #include "game.h"
+    static void* gameState = NULL;
+#endif
+
+// Sized from the generated manifest. The manifest's extensions take IDs 0..EXTENSION_COUNT-1
+// (the EXTENSION_ID_* constants); the runtime slots are for extensions registered outside it
+// (tools, benchmarks).
+#define EXTENSION_RUNTIME_SLOTS 8
+#define EXTENSION_CAPACITY (EXTENSION_COUNT + EXTENSION_RUNTIME_SLOTS)
+static ExtensionInterface* g_extensions[EXTENSION_CAPACITY];
+static void* g_extension_apis[EXTENSION_CAPACITY]; // GetSpecificAPI results, indexed by ExtensionID
 static int g_extension_count = 0;
 
-static void* Engine_GetExtensionAPI(const char* name) {
+// Init progress per extension. Lookups and startup tasks race to claim PENDING; whoever wins runs
+// Init, the others wait for READY or FAILED.
+typedef enum ExtensionState {
+  EXTENSION_STATE_PENDING = 0,
+  EXTENSION_STATE_INITIALIZING,
+  EXTENSION_STATE_READY,
+  EXTENSION_STATE_FAILED,
+} ExtensionState;
+
+static volatile size_t g_extension_states[EXTENSION_CAPACITY]; // ExtensionState
+static uint64_t g_extension_init_ns[EXTENSION_CAPACITY];
+static bool g_extensions_started = false; // Registering after startup inits right away
+
+// Appended as each Init finishes (possibly on a worker), so reverse order always has an extension's
+// dependencies still up while it shuts down
+static void (*g_extension_shutdowns[EXTENSION_CAPACITY])(void);
+static volatile size_t g_extension_shutdown_count = 0;
+static float g_last_delta_time = 0.0f; // For EXTENSION_PHASE_PRE_RENDER
+
+// Fixed-timestep simulation
+#ifndef ENGINE_TICK_RATE
+#define ENGINE_TICK_RATE 60
+#endif
+#define ENGINE_MAX_CATCHUP_TICKS 5
+static double g_tick_step = 1.0 / ENGINE_TICK_RATE;
+static uint32_t g_tick_rate = ENGINE_TICK_RATE;
+static double g_tick_accumulator = 0.0; // Real time not yet simulated
+static float g_render_alpha = 0.0f;
+
+// Pipelined frames: a simulation thread steps frame N+1 while the main thread renders frame N from
+// a snapshot. Each snapshot lives in its own frame arena; the simulation fills one while render
+// reads the other, and they swap at the sync point in Engine_Frame.
+#ifndef ENGINE_PIPELINED
+#define ENGINE_PIPELINED 0
+#endif
+#ifndef ENGINE_FRAME_ARENA_SIZE
+#define ENGINE_FRAME_ARENA_SIZE MEGABYTES(8)
+#endif
+
+typedef struct EngineFrame {
+  Arena* arena;     // Reset by the snapshot that refills it
+  float alpha;      // Interpolation alpha after the frame's ticks
+  float frame_time; // Real time the frame covered (the pre-render extensions' dt)
+#ifdef ENABLE_GAME_AS_PLUGIN
+  PluginRenderFrame* render_data;
+#else
+  void* render_data;
+#endif
+} EngineFrame;
+
+typedef struct EnginePipeline {
+  PlatformThread* thread;
+  PlatformSemaphore* start; // Main -> simulation: step frames[sim_index]
+  PlatformSemaphore* done;  // Simulation -> main: frames[sim_index] is ready to render
+  EngineFrame frames[2];
+  uint32_t sim_index;       // Only changed while the simulation thread is idle
+  float sim_frame_time;
+  bool quit;
+  bool running;
+} EnginePipeline;
+
+static EnginePipeline g_pipeline;
+
+static inline bool Engine_IsExtensionReady(ExtensionID id) {
+  return Platform_AtomicLoadSize(&g_extension_states[id]) == EXTENSION_STATE_READY;
+}
+
+#ifndef ENABLE_GAME_AS_PLUGIN
+// Static builds: direct calls generated from the extension definitions (tools/manifest_gen.c)
+#include "extension_dispatch_generated.h"
+#else
+typedef void (*ExtensionUpdateFunc)(float dt);
+
+// An Update that doesn't run every frame, with its rate state
+typedef struct ExtensionScheduledUpdate {
+  ExtensionUpdateFunc update;
+  ExtensionUpdateRate rate;
+  uint32_t interval;
+  float step;
+  uint32_t frames;
+  float elapsed;       // EVERY_N_FRAMES: dt since the last call; FIXED_STEP: accumulated, not yet stepped
+  ExtensionID lazy_id; // Lazy extensions are skipped until initialised (EXTENSION_ID_INVALID otherwise)
+} ExtensionScheduledUpdate;
+
+// Built at registration: only extensions that have an Update, grouped by phase, so running a phase
+// is a walk over contiguous function pointers with nothing to check. Lazy extensions go through
+// scheduled, which can skip them.
+typedef struct ExtensionPhaseTable {
+  ExtensionUpdateFunc every_frame[EXTENSION_CAPACITY];
+  uint32_t every_frame_count;
+  ExtensionScheduledUpdate scheduled[EXTENSION_CAPACITY];
+  uint32_t scheduled_count;
+} ExtensionPhaseTable;
+
+static ExtensionPhaseTable g_extension_phases[EXTENSION_PHASE_COUNT];
+#endif
+
+static ExtensionID Engine_GetExtensionID(const char* name) {
+  if (!name) {
+    return EXTENSION_ID_INVALID;
+  }
+
   for (int i = 0; i < g_extension_count; ++i) {
     if (strcmp(g_extensions[i]->name, name) == 0) {
-      return g_extensions[i]->GetSpecificAPI();
+      return (ExtensionID)i;
     }
   }
-  return NULL;
+  return EXTENSION_ID_INVALID;
+}
+
+static bool Engine_InitExtension(ExtensionID id);
+
+static void* Engine_GetExtensionAPIByID(ExtensionID id) {
+  if (id >= (ExtensionID)g_extension_count) {
+    return NULL;
+  }
+  if (Engine_IsExtensionReady(id)) {
+    return g_extension_apis[id];
+  }
+
+  // First use of a lazy extension (or one registered without an engine start)
+  return Engine_InitExtension(id) ? g_extension_apis[id] : NULL;
+}
+
+static void* Engine_GetExtensionAPI(const char* name) {
+  return Engine_GetExtensionAPIByID(Engine_GetExtensionID(name));
+}
+
+static float Engine_GetRenderAlpha(void) {
+  return g_render_alpha;
+}
+
+static uint32_t Engine_GetWorkerCount(void) {
+  return WorkerPool_GetWorkerCount();
 }
 
 // Update global API instance
 static EngineAPI g_engine_api = {
-  .GetExtensionAPI = Engine_GetExtensionAPI
+  .GetExtensionAPI = Engine_GetExtensionAPI,
+  .GetExtensionID = Engine_GetExtensionID,
+  .GetExtensionAPIByID = Engine_GetExtensionAPIByID,
+  .GetRenderAlpha = Engine_GetRenderAlpha,
+  .GetWorkerCount = Engine_GetWorkerCount
 };
 
-// Global function (called by Manifest)
-void Engine_RegisterExtension(ExtensionInterface* ext) {
-  if (g_extension_count < MAX_EXTENSIONS) {
-    g_extensions[g_extension_count++] = ext;
-    // Init immediately
-    if (ext->Init) {
-      ext->Init(&g_engine_api, Platform_GetAPI());
+static double Engine_NSToMS(uint64_t ns) {
+  return (double)ns / 1000000.0;
+}
+
+// Run Init (dependencies first) unless someone already has. Safe from any thread; returns whether
+// the extension is up. Dependency cycles are rejected by Engine_StartExtensions.
+static bool Engine_InitExtension(ExtensionID id) {
+  size_t expected = EXTENSION_STATE_PENDING;
+  if (!Platform_AtomicCompareExchangeSize(&g_extension_states[id], &expected, EXTENSION_STATE_INITIALIZING)) {
+    // Claimed by another thread: wait for it (inits are one-off and short next to startup)
+    while (expected == EXTENSION_STATE_INITIALIZING) {
+      Platform_CPURelax();
+      expected = Platform_AtomicLoadSize(&g_extension_states[id]);
+    }
+    return expected == EXTENSION_STATE_READY;
+  }
+
+  ExtensionInterface* ext = g_extensions[id];
+  bool ok = true;
+  for (const char* const* dep = ext->dependencies; ok && dep && *dep; ++dep) {
+    ExtensionID dep_id = Engine_GetExtensionID(*dep);
+    if (dep_id == EXTENSION_ID_INVALID) {
+      Platform_LogError("Extension '%s' depends on '%s', which isn't registered", ext->name, *dep);
+      ok = false;
+    } else if (!Engine_InitExtension(dep_id)) {
+      Platform_LogError("Extension '%s' not initialized: dependency '%s' failed", ext->name, *dep);
+      ok = false;
     }
   }
+
+  uint64_t start = Platform_GetTicksNS();
+  if (ok && ext->Init && !ext->Init(&g_engine_api, Platform_GetAPI())) {
+    Platform_LogError("Extension '%s' failed to initialize", ext->name);
+    ok = false;
+  }
+  g_extension_init_ns[id] = Platform_GetTicksNS() - start;
+
+  if (ok) {
+    // The API struct is fixed for the life of the process: fetch it once here rather than per lookup
+    g_extension_apis[id] = ext->GetSpecificAPI ? ext->GetSpecificAPI() : NULL;
+    if (ext->Shutdown) {
+      g_extension_shutdowns[Platform_AtomicFetchAddSize(&g_extension_shutdown_count, 1)] = ext->Shutdown;
+    }
+    Platform_Log("Extension '%s' initialized in %.2f ms%s", ext->name,
+                 Engine_NSToMS(g_extension_init_ns[id]), ext->lazy ? " (lazy)" : "");
+  }
+
+  Platform_AtomicStoreSize(&g_extension_states[id], ok ? EXTENSION_STATE_READY : EXTENSION_STATE_FAILED);
+  return ok;
 }
 
-// TODO: (ARC) These add a significant amount of validation(branching) & dispatch as we add extensions.
-// Probably better to just register valid update calls into a concrete "extension update" list in Engine_RegisterExtension.
-void Engine_UpdateStaticExtensions(const float dt) {
-  int extensionIdx = 0;
-  for (extensionIdx = 0; extensionIdx < g_extension_count; ++extensionIdx) {
-    const ExtensionInterface *ext = g_extensions[extensionIdx];
-    if (ext->Update) {
-      ext->Update(dt);
+// Global function (called by Manifest). Init runs later, from Engine_StartExtensions, unless the
+// engine has already started.
+void Engine_RegisterExtension(ExtensionInterface* ext) {
+  if (g_extension_count >= EXTENSION_CAPACITY) {
+    Platform_LogError("Too many extensions registered (%d from the manifest + %d), dropping '%s'",
+                      EXTENSION_COUNT, EXTENSION_RUNTIME_SLOTS, ext->name);
+    return;
+  }
+
+  ext->id = (uint32_t)g_extension_count;
+  g_extensions[g_extension_count] = ext;
+  g_extension_states[ext->id] = EXTENSION_STATE_PENDING;
+  g_extension_apis[ext->id] = NULL;
+  g_extension_count++;
+
+  // Late registrations have no startup pass to wait for; a failure just leaves the extension out
+  if (g_extensions_started && !ext->lazy && !Engine_InitExtension(ext->id)) {
+    return;
+  }
+
+#ifdef ENABLE_GAME_AS_PLUGIN
+  if (ext->Update) {
+    ExtensionPhaseTable* table = &g_extension_phases[ext->phase < EXTENSION_PHASE_COUNT ? ext->phase : 0];
+    if (ext->update_rate == EXTENSION_UPDATE_EVERY_FRAME && !ext->lazy) {
+      table->every_frame[table->every_frame_count++] = ext->Update;
+    } else {
+      table->scheduled[table->scheduled_count++] = (ExtensionScheduledUpdate){
+        .update = ext->Update,
+        .rate = ext->update_rate,
+        .interval = ext->update_interval,
+        .step = ext->update_step,
+        .lazy_id = ext->lazy ? ext->id : EXTENSION_ID_INVALID,
+      };
     }
   }
+#endif
 }
 
-void Engine_ShutdownStaticExtensions() {
-  int extensionIdx = 0;
-  for (extensionIdx = 0; extensionIdx < g_extension_count; ++extensionIdx) {
-    const ExtensionInterface *ext = g_extensions[extensionIdx];
-    if (ext->Shutdown) {
-      ext->Shutdown();
+// Startup wave of an extension: one past its deepest dependency (0 = none). -1 on a missing
+// dependency or a cycle. visit: 0 = not seen, 1 = on the current path, 2 = done.
+static int Engine_ExtensionWave(ExtensionID id, uint8_t* visit, int* waves) {
+  if (visit[id] == 2) {
+    return waves[id];
+  }
+  if (visit[id] == 1) {
+    Platform_LogError("Extension dependency cycle through '%s'", g_extensions[id]->name);
+    return -1;
+  }
+
+  visit[id] = 1;
+  int wave = 0;
+  for (const char* const* dep = g_extensions[id]->dependencies; dep && *dep; ++dep) {
+    ExtensionID dep_id = Engine_GetExtensionID(*dep);
+    if (dep_id == EXTENSION_ID_INVALID) {
+      Platform_LogError("Extension '%s' depends on '%s', which isn't registered", g_extensions[id]->name, *dep);
+      return -1;
+    }
+    int dep_wave = Engine_ExtensionWave(dep_id, visit, waves);
+    if (dep_wave < 0) {
+      return -1;
+    }
+    if (dep_wave + 1 > wave) {
+      wave = dep_wave + 1;
     }
   }
+
+  visit[id] = 2;
+  waves[id] = wave;
+  return wave;
 }
 
-EngineAPI* Engine_GetAPI(void) {
-  return &g_engine_api;
+// A lazy extension something eager depends on can't wait for its first lookup
+static void Engine_MarkExtensionRequired(ExtensionID id, bool* required) {
+  if (required[id]) {
+    return;
+  }
+  required[id] = true;
+  for (const char* const* dep = g_extensions[id]->dependencies; dep && *dep; ++dep) {
+    Engine_MarkExtensionRequired(Engine_GetExtensionID(*dep), required);
+  }
+}
+
+static void Engine_InitExtensionTask(void* data, uint32_t index) {
+  Engine_InitExtension(((const ExtensionID*)data)[index]);
+}
+
+// Initialise every non-lazy extension, one dependency wave at a time, each wave spread over the
+// worker pool. Startup then costs the longest dependency chain rather than the sum of every Init.
+static bool Engine_StartExtensions(void) {
+  uint64_t start = Platform_GetTicksNS();
+
+  uint8_t visit[EXTENSION_CAPACITY] = {0};
+  int waves[EXTENSION_CAPACITY];
+  bool required[EXTENSION_CAPACITY] = {0};
+  for (int i = 0; i < g_extension_count; ++i) {
+    if (Engine_ExtensionWave((ExtensionID)i, visit, waves) < 0) {
+      return false;
+    }
+  }
+
+  int wave_count = 0;
+  for (int i = 0; i < g_extension_count; ++i) {
+    if (!g_extensions[i]->lazy) {
+      Engine_MarkExtensionRequired((ExtensionID)i, required);
+    }
+  }
+  for (int i = 0; i < g_extension_count; ++i) {
+    if (required[i] && waves[i] + 1 > wave_count) {
+      wave_count = waves[i] + 1;
+    }
+  }
+
+  ExtensionID batch[EXTENSION_CAPACITY];
+  for (int wave = 0; wave < wave_count; ++wave) {
+    uint32_t count = 0;
+    for (int i = 0; i < g_extension_count; ++i) {
+      if (required[i] && waves[i] == wave) {
+        batch[count++] = (ExtensionID)i;
+      }
+    }
+    WorkerPool_Run(Engine_InitExtensionTask, batch, count);
+  }
+  g_extensions_started = true;
+
+  bool ok = true;
+  int initialized = 0;
+  int deferred = 0;
+  uint64_t init_total = 0;
+  for (int i = 0; i < g_extension_count; ++i) {
+    if (!required[i]) {
+      deferred++;
+      continue;
+    }
+    if (!Engine_IsExtensionReady((ExtensionID)i)) {
+      ok = false;
+      continue;
+    }
+    initialized++;
+    init_total += g_extension_init_ns[i];
+  }
+
+  Platform_Log("Extensions initialized: %d of %d in %.2f ms (%.2f ms of Init, %d waves, %d lazy)",
+               initialized, g_extension_count, Engine_NSToMS(Platform_GetTicksNS() - start),
+               Engine_NSToMS(init_total), wave_count, deferred);
+  return ok;
 }
 
 #ifdef ENABLE_GAME_AS_PLUGIN
-    // Hot reload build - use plugin system
-    #include "plugin_manager.h"
+static void Engine_RunScheduledUpdate(ExtensionScheduledUpdate* scheduled, const float dt) {
+  if (scheduled->lazy_id != EXTENSION_ID_INVALID && !Engine_IsExtensionReady(scheduled->lazy_id)) {
+    return;
+  }
+
+  if (scheduled->rate == EXTENSION_UPDATE_EVERY_FRAME) {
+    scheduled->update(dt);
+    return;
+  }
+
+  if (scheduled->rate == EXTENSION_UPDATE_EVERY_N_FRAMES) {
+    scheduled->elapsed += dt;
+    if (++scheduled->frames >= scheduled->interval) {
+      scheduled->update(scheduled->elapsed);
+      scheduled->frames = 0;
+      scheduled->elapsed = 0.0f;
+    }
+    return;
+  }
+
+  const float max_backlog = scheduled->step * EXTENSION_MAX_CATCHUP_STEPS;
+  scheduled->elapsed += dt;
+  if (scheduled->elapsed > max_backlog) {
+    scheduled->elapsed = max_backlog;
+  }
+  while (scheduled->step > 0.0f && scheduled->elapsed >= scheduled->step) {
+    scheduled->update(scheduled->step);
+    scheduled->elapsed -= scheduled->step;
+  }
+}
+#endif
+
+static void Engine_UpdateExtensions(const ExtensionPhase phase, const float dt) {
+#ifndef ENABLE_GAME_AS_PLUGIN
+  switch (phase) {
+    case EXTENSION_PHASE_PRE_GAME: ExtensionDispatch_PreGame(dt); break;
+    case EXTENSION_PHASE_POST_GAME: ExtensionDispatch_PostGame(dt); break;
+    case EXTENSION_PHASE_PRE_RENDER: ExtensionDispatch_PreRender(dt); break;
+    default: break;
+  }
 #else
-    // Static build - direct link to game
-    #include "game.h"
-    static void* gameState = NULL;
+  ExtensionPhaseTable* table = &g_extension_phases[phase];
+  for (uint32_t i = 0; i < table->every_frame_count; ++i) {
+    table->every_frame[i](dt);
+  }
+  for (uint32_t i = 0; i < table->scheduled_count; ++i) {
+    Engine_RunScheduledUpdate(&table->scheduled[i], dt);
+  }
 #endif
+}
+
+// Reverse init order: anything an extension relies on is still up while it shuts down
+static void Engine_ShutdownExtensions(void) {
+  for (size_t i = g_extension_shutdown_count; i-- > 0;) {
+    g_extension_shutdowns[i]();
+  }
+  g_extension_shutdown_count = 0;
+}
+
+EngineAPI* Engine_GetAPI(void) {
+  return &g_engine_api;
+}
 
 bool Engine_Initialize(void) {
   Platform_Log("Engine Initializing.");
 
+  // Before anything that may want to spread work over cores (plugin updates)
+  if (!WorkerPool_Init(0)) {
+    Platform_LogError("Failed to initialize worker pool");
+    return false;
+  }
+
   // Forward declaration (function defined in static_manifest.c)
   void Engine_LoadStaticExtensions(void);
   Engine_LoadStaticExtensions();
 
+  if (!Engine_StartExtensions()) {
+    Platform_LogError("Failed to initialize extensions");
+    return false;
+  }
+
 #ifdef ENABLE_GAME_AS_PLUGIN
   // Hot reload path - use plugin manager
   if (!PluginManager_Init()) {
@@ -127,6 +503,10 @@ bool Engine_Initialize(void) {
   }
 #endif
 
+  if (ENGINE_PIPELINED && !Engine_SetPipelined(true)) {
+    Platform_LogWarning("Pipelined frames unavailable, rendering in step with the simulation");
+  }
+
   return true;
 }
 
@@ -135,21 +515,68 @@ void Engine_Update(float deltaTime) {
 
   // Only include hot reload checks if ordered to at compile time by the config.
   #ifdef ENABLE_HOT_RELOAD
-    // Check for hot reloads
-    PluginManager_CheckReloadAll();
+    // Check for hot reloads. Pipelined frames check at the sync point instead, where nothing is
+    // rendering from the old build.
+    if (!g_pipeline.running) {
+      PluginManager_CheckReloadAll();
+    }
   #endif
 
+  Engine_UpdateExtensions(EXTENSION_PHASE_PRE_GAME, deltaTime);
+
   // Update all plugins
   PluginManager_UpdateAll(deltaTime);
 #else
+  Engine_UpdateExtensions(EXTENSION_PHASE_PRE_GAME, deltaTime);
+
   // Direct call to statically linked game
   Game_Update(gameState, deltaTime);
 #endif
 
-  Engine_UpdateStaticExtensions(deltaTime);
+  Engine_UpdateExtensions(EXTENSION_PHASE_POST_GAME, deltaTime);
+  g_last_delta_time = deltaTime;
+}
+
+void Engine_SetTickRate(uint32_t ticksPerSecond) {
+  if (ticksPerSecond == 0) {
+    Platform_LogError("Tick rate must be at least 1 tick per second");
+    return;
+  }
+  g_tick_rate = ticksPerSecond;
+  g_tick_step = 1.0 / ticksPerSecond;
+}
+
+uint32_t Engine_GetTickRate(void) {
+  return g_tick_rate;
 }
 
-void Engine_Render(void) {
+float Engine_Advance(float frameTime) {
+  // A hitch (breakpoint, load, window drag) shouldn't turn into a burst of ticks that makes the
+  // next frame slower still: keep at most ENGINE_MAX_CATCHUP_TICKS of backlog
+  const double max_backlog = g_tick_step * ENGINE_MAX_CATCHUP_TICKS;
+  g_tick_accumulator += frameTime > 0.0f ? frameTime : 0.0f;
+  if (g_tick_accumulator > max_backlog) {
+    g_tick_accumulator = max_backlog;
+  }
+
+  while (g_tick_accumulator >= g_tick_step) {
+    Engine_Update((float)g_tick_step);
+    g_tick_accumulator -= g_tick_step;
+  }
+
+  // Pre-render extensions run once per rendered frame, so they get real time rather than the tick
+  g_last_delta_time = frameTime;
+  return (float)(g_tick_accumulator / g_tick_step);
+}
+
+static void Engine_RenderPass(const float alpha, const float frameTime) {
+  g_render_alpha = alpha;
+  Engine_UpdateExtensions(EXTENSION_PHASE_PRE_RENDER, frameTime);
+}
+
+void Engine_Render(float alpha) {
+  Engine_RenderPass(alpha, g_last_delta_time);
+
 #ifdef ENABLE_GAME_AS_PLUGIN
   // Render all plugins
   PluginManager_RenderAll();
@@ -159,9 +586,165 @@ void Engine_Render(void) {
 #endif
 }
 
+// ============================================================================
+// Pipelined Frames
+// ============================================================================
+static bool Engine_CanPipeline(void) {
+#ifdef ENABLE_GAME_AS_PLUGIN
+  return PluginManager_CanPipeline();
+#else
+  return true;
+#endif
+}
+
+// Simulation thread, or the main thread while the simulation is idle
+static void Engine_SnapshotFrame(EngineFrame* frame) {
+  Arena_Reset(frame->arena);
+#ifdef ENABLE_GAME_AS_PLUGIN
+  frame->render_data = PluginManager_SnapshotAll(frame->arena);
+#else
+  frame->render_data = Game_Snapshot(gameState, frame->arena);
+#endif
+}
+
+static int Engine_SimulationMain(void* data) {
+  (void)data;
+
+  for (;;) {
+    Platform_SemaphoreWait(g_pipeline.start);
+    if (g_pipeline.quit) {
+      break;
+    }
+
+    EngineFrame* frame = &g_pipeline.frames[g_pipeline.sim_index];
+    frame->frame_time = g_pipeline.sim_frame_time;
+    frame->alpha = Engine_Advance(frame->frame_time);
+    Engine_SnapshotFrame(frame);
+    Platform_SemaphorePost(g_pipeline.done, 1);
+  }
+
+  Arena_ReleaseThreadScratch();
+  return 0;
+}
+
+static bool Engine_StartPipeline(void) {
+  for (int i = 0; i < 2; ++i) {
+    if (g_pipeline.frames[i].arena) {
+      continue;
+    }
+    g_pipeline.frames[i].arena = Arena_CreateBump(Platform_GetRootArena(), ENGINE_FRAME_ARENA_SIZE, DEFAULT_ALIGNMENT);
+    if (!g_pipeline.frames[i].arena) {
+      Platform_LogError("Failed to create frame arena for pipelined frames");
+      return false;
+    }
+    Arena_SetDebugName(g_pipeline.frames[i].arena, i == 0 ? "Engine::Frame0" : "Engine::Frame1");
+  }
+
+  g_pipeline.start = Platform_SemaphoreCreate(0);
+  g_pipeline.done = Platform_SemaphoreCreate(0);
+  g_pipeline.quit = false;
+  g_pipeline.thread = g_pipeline.start && g_pipeline.done
+                        ? Platform_ThreadCreate(Engine_SimulationMain, "flight_simulation", NULL)
+                        : NULL;
+  if (!g_pipeline.thread) {
+    Platform_LogError("Failed to start the simulation thread for pipelined frames");
+    if (g_pipeline.start) Platform_SemaphoreDestroy(g_pipeline.start);
+    if (g_pipeline.done) Platform_SemaphoreDestroy(g_pipeline.done);
+    g_pipeline.start = NULL;
+    g_pipeline.done = NULL;
+    return false;
+  }
+
+  // Prime the pipeline with a frame that covers no time, so the first Engine_Frame has a snapshot
+  // of the current state to render while the simulation steps the next one
+  g_pipeline.sim_index = 0;
+  g_pipeline.sim_frame_time = 0.0f;
+  g_pipeline.running = true;
+  Platform_SemaphorePost(g_pipeline.start, 1);
+  return true;
+}
+
+// Waits for the simulation thread to finish its frame (which is never rendered)
+static void Engine_StopPipeline(void) {
+  Platform_SemaphoreWait(g_pipeline.done);
+  g_pipeline.quit = true;
+  Platform_SemaphorePost(g_pipeline.start, 1);
+  Platform_ThreadJoin(g_pipeline.thread);
+  Platform_SemaphoreDestroy(g_pipeline.start);
+  Platform_SemaphoreDestroy(g_pipeline.done);
+  g_pipeline.thread = NULL;
+  g_pipeline.start = NULL;
+  g_pipeline.done = NULL;
+  g_pipeline.running = false;
+}
+
+bool Engine_SetPipelined(bool enabled) {
+  if (enabled == g_pipeline.running) {
+    return true;
+  }
+  if (!enabled) {
+    Engine_StopPipeline();
+    return true;
+  }
+  if (!Engine_CanPipeline()) {
+    Platform_LogWarning("Pipelined frames need snapshot and render_snapshot from every plugin");
+    return false;
+  }
+  return Engine_StartPipeline();
+}
+
+bool Engine_IsPipelined(void) {
+  return g_pipeline.running;
+}
+
+void Engine_Frame(float frameTime) {
+  if (!g_pipeline.running) {
+    Engine_Render(Engine_Advance(frameTime));
+    return;
+  }
+
+  // Sync point: the simulation thread is idle until it's started again below
+  Platform_SemaphoreWait(g_pipeline.done);
+  EngineFrame* ready = &g_pipeline.frames[g_pipeline.sim_index];
+
+#if defined(ENABLE_GAME_AS_PLUGIN) && defined(ENABLE_HOT_RELOAD)
+  if (PluginManager_CheckReloadAll()) {
+    if (!PluginManager_CanPipeline()) {
+      // The new build can't snapshot: stop the (idle) simulation thread and carry on in step
+      Platform_LogWarning("Reloaded plugin has no snapshot/render_snapshot, pipelined frames off");
+      Platform_SemaphorePost(g_pipeline.done, 1);
+      Engine_StopPipeline();
+      Engine_Render(Engine_Advance(frameTime));
+      return;
+    }
+    // The snapshot came from the old build and may not match the new state layout
+    Engine_SnapshotFrame(ready);
+  }
+#endif
+
+  // Step the next frame into the other arena while this one renders
+  g_pipeline.sim_index ^= 1;
+  g_pipeline.sim_frame_time = frameTime;
+  Platform_SemaphorePost(g_pipeline.start, 1);
+
+  // Pre-render extensions run alongside the simulation's pre/post-game ones
+  Engine_RenderPass(ready->alpha, ready->frame_time);
+#ifdef ENABLE_GAME_AS_PLUGIN
+  PluginManager_RenderSnapshotAll(ready->render_data);
+#else
+  // NULL when the snapshot didn't fit the frame arena: skip the frame, as the plugin path does
+  if (ready->render_data) {
+    Game_RenderSnapshot(ready->render_data);
+  }
+#endif
+}
+
 void Engine_Shutdown(void) {
   Platform_Log("Engine Shutting Down.");
 
+  // Before the game goes away under the simulation thread
+  Engine_SetPipelined(false);
+
 #ifdef ENABLE_GAME_AS_PLUGIN
   // Shutdown plugin system
   PluginManager_Shutdown();
@@ -172,5 +755,14 @@ void Engine_Shutdown(void) {
   }
 #endif
 
-  Engine_ShutdownStaticExtensions();
+  for (int i = 0; i < 2; ++i) {
+    if (g_pipeline.frames[i].arena) {
+      Arena_Destroy(g_pipeline.frames[i].arena);
+      g_pipeline.frames[i].arena = NULL;
+    }
+  }
+
+  Engine_ShutdownExtensions();
+
+  WorkerPool_Shutdown();
 }
\ No newline at end of file
@@ -2,34 +2,295 @@
 // All rights reserved.
 
 #include "plugin_manager.h"
+#include "arena.h"
+#include "arena_array.h"
 #include "plugin_api.h"
 #include "platform_api.h"
 #include "engine_api.h"
 #include "platform.h"
 #include "platform_plugin.h"
+#include "worker_pool.h"
 #include <string.h>
 
-#define MAX_PLUGINS 32
+// Everything the manager owns (record chunks, index table, hot array) lives here and goes
+// away in one Arena_Destroy at shutdown
+#define PLUGIN_MANAGER_ARENA_SIZE MEGABYTES(4)
+
+// First record chunk holds this many records; each new chunk doubles
+#define PLUGIN_RECORD_CHUNK_MIN 16
 
 typedef struct {
     PlatformPlugin* handle;
     PluginAPI* api;
     void* state;
-    bool active;
-    char path[256];
+    int index;      // Slot in g_plugins (returned by PluginManager_Load)
+    int hot_index;  // Slot in g_hot, -1 when not active
+    uint32_t wave;  // Update wave (see PluginManager_BuildSchedule)
 } LoadedPlugin;
 
-static LoadedPlugin g_plugins[MAX_PLUGINS];
-static int g_plugin_count = 0;
+// What UpdateAll/RenderAll touch, packed densely. Only active plugins have an entry, and
+// missing callbacks are no-ops, so the loops never branch. Kept sorted by (wave, load order).
+typedef struct {
+    void (*update)(void* state, float delta_time);
+    void (*render)(void* state);
+    void* state;
+    LoadedPlugin* plugin;
+} PluginHot;
+
+// One plugin's part of a PluginRenderFrame. The draw function is captured with the data so a
+// frame always renders with the build that produced it.
+typedef struct {
+    void (*render)(const void* render_data);
+    const void* data;
+} PluginRenderEntry;
+
+struct PluginRenderFrame {
+    size_t count;
+    PluginRenderEntry entries[];
+};
+
+// Plugins that can update at the same time: g_hot[start, start + count)
+typedef struct {
+    uint32_t start;
+    uint32_t count;
+} PluginWave;
+
+// Fixed-size records handed out by a chain of Block arenas. Freed records go back to their
+// chunk's free list and are reused by the next load; a full chain grows by another chunk.
+typedef struct {
+    const char* name;
+    size_t record_size;
+    size_t alignment;
+    ArenaArray chunks; // Arena*
+} RecordPool;
+
+static Arena* g_manager_arena = NULL;
+static RecordPool g_loaded_records;   // LoadedPlugin
+static RecordPool g_platform_records; // PlatformPlugin (allocated by Platform_PluginLoad)
+static ArenaArray g_plugins;          // LoadedPlugin*, indexed by plugin index (NULL = free slot)
+static ArenaArray g_hot;              // PluginHot
+static ArenaArray g_waves;            // PluginWave: consecutive runs of g_hot that update together
+static bool g_schedule_dirty = false; // Rebuild g_waves before the next update
+static int g_plugin_count = 0;        // Live records
 static bool g_initialized = false;
 
+// ============================================================================
+// Record Pools
+// ============================================================================
+static void RecordPool_Init(RecordPool* pool, const char* name, size_t record_size, size_t alignment) {
+    pool->name = name;
+    pool->record_size = record_size;
+    pool->alignment = alignment;
+    pool->chunks = ArenaArray_Init(g_manager_arena, Arena*, 4);
+}
+
+// A chunk with a free record, adding one if they're all full
+static Arena* RecordPool_GetChunk(RecordPool* pool) {
+    for (size_t i = 0; i < pool->chunks.count; i++) {
+        Arena* chunk = ArenaArray_At(&pool->chunks, Arena*, i);
+        if (chunk->data.block.free_count > 0) {
+            return chunk;
+        }
+    }
+
+    const size_t records = (size_t)PLUGIN_RECORD_CHUNK_MIN << pool->chunks.count;
+    Arena* chunk = Arena_CreateBlock(g_manager_arena, pool->record_size, records, pool->alignment);
+    Arena** slot = ArenaArray_PushType(&pool->chunks, Arena*);
+    if (!chunk || !slot) {
+        Platform_LogError("Plugin manager out of memory for %s records", pool->name);
+        return NULL;
+    }
+    Arena_SetDebugName(chunk, pool->name);
+    *slot = chunk;
+    return chunk;
+}
+
+static void* RecordPool_Alloc(RecordPool* pool) {
+    Arena* chunk = RecordPool_GetChunk(pool);
+    return chunk ? Arena_AllocAligned(chunk, pool->record_size, pool->alignment) : NULL;
+}
+
+static void RecordPool_Free(RecordPool* pool, void* record) {
+    for (size_t i = 0; i < pool->chunks.count; i++) {
+        Arena* chunk = ArenaArray_At(&pool->chunks, Arena*, i);
+        const char* base = (const char*)chunk->base;
+        if ((const char*)record >= base && (const char*)record < base + chunk->size) {
+            Arena_Free(chunk, record);
+            return;
+        }
+    }
+    Platform_LogError("Plugin manager: %p is not a %s record", record, pool->name);
+}
+
+// ============================================================================
+// Hot Array
+// ============================================================================
+static void PluginManager_NoUpdate(void* state, float delta_time) {
+    (void)state;
+    (void)delta_time;
+}
+
+static void PluginManager_NoRender(void* state) {
+    (void)state;
+}
+
+// Refresh the plugin's hot entry after its API or state pointer changed
+static void PluginManager_SyncHot(const LoadedPlugin* plugin) {
+    if (plugin->hot_index < 0) return;
+
+    PluginHot* hot = &ArenaArray_At(&g_hot, PluginHot, plugin->hot_index);
+    hot->update = plugin->api->update ? plugin->api->update : PluginManager_NoUpdate;
+    hot->render = plugin->api->render ? plugin->api->render : PluginManager_NoRender;
+    hot->state = plugin->state;
+
+    // A new build may declare different accesses
+    g_schedule_dirty = true;
+}
+
+static bool PluginManager_Activate(LoadedPlugin* plugin) {
+    PluginHot* hot = ArenaArray_PushType(&g_hot, PluginHot);
+    if (!hot) {
+        return false;
+    }
+    hot->plugin = plugin;
+    plugin->hot_index = (int)(g_hot.count - 1);
+    PluginManager_SyncHot(plugin);
+    return true;
+}
+
+static void PluginManager_Deactivate(LoadedPlugin* plugin) {
+    if (plugin->hot_index < 0) return;
+
+    // Swap the last entry into the hole; the schedule rebuild restores the order
+    PluginHot* hot = (PluginHot*)g_hot.data;
+    const size_t last = g_hot.count - 1;
+    if ((size_t)plugin->hot_index != last) {
+        hot[plugin->hot_index] = hot[last];
+        hot[plugin->hot_index].plugin->hot_index = plugin->hot_index;
+    }
+    g_hot.count--;
+    plugin->hot_index = -1;
+    g_schedule_dirty = true;
+}
+
+// ============================================================================
+// Update Schedule
+// ============================================================================
+static bool Plugin_ListHas(const char* const* list, const char* name) {
+    for (; list && *list; list++) {
+        if (strcmp(*list, name) == 0) return true;
+    }
+    return false;
+}
+
+static bool Plugin_Touches(const PluginAPI* api, const char* resource) {
+    return (api->name && strcmp(api->name, resource) == 0) ||
+           Plugin_ListHas(api->update_reads, resource) ||
+           Plugin_ListHas(api->update_writes, resource);
+}
+
+// Does a write anything b reads or writes?
+static bool Plugin_WritesInto(const PluginAPI* a, const PluginAPI* b) {
+    if (a->name && Plugin_Touches(b, a->name)) return true;
+    for (const char* const* write = a->update_writes; write && *write; write++) {
+        if (Plugin_Touches(b, *write)) return true;
+    }
+    return false;
+}
+
+static bool Plugin_UpdatesConflict(const PluginAPI* a, const PluginAPI* b) {
+    // No declaration means the plugin may touch anything
+    if ((!a->update_reads && !a->update_writes) || (!b->update_reads && !b->update_writes)) {
+        return true;
+    }
+    return Plugin_WritesInto(a, b) || Plugin_WritesInto(b, a);
+}
+
+// Insertion sort: the hot array is short and usually nearly sorted already
+static void PluginManager_SortHot(bool by_wave) {
+    PluginHot* hot = (PluginHot*)g_hot.data;
+    for (size_t i = 1; i < g_hot.count; i++) {
+        const PluginHot entry = hot[i];
+        size_t j = i;
+        while (j > 0) {
+            const LoadedPlugin* prev = hot[j - 1].plugin;
+            const bool after = by_wave && prev->wave != entry.plugin->wave
+                                   ? prev->wave > entry.plugin->wave
+                                   : prev->index > entry.plugin->index;
+            if (!after) break;
+            hot[j] = hot[j - 1];
+            j--;
+        }
+        hot[j] = entry;
+    }
+}
+
+// Order updates as a DAG: every conflicting pair gets an edge from the earlier-loaded plugin to
+// the later one, and each plugin's wave is one past the latest wave it depends on. Waves run
+// one after the other; the plugins inside a wave run concurrently. The result depends only on
+// load order and declarations, so dependent plugins always see the same ordering.
+static void PluginManager_BuildSchedule(void) {
+    PluginHot* hot = (PluginHot*)g_hot.data;
+
+    PluginManager_SortHot(false);
+    for (size_t i = 0; i < g_hot.count; i++) {
+        LoadedPlugin* plugin = hot[i].plugin;
+        plugin->wave = 0;
+        for (size_t j = 0; j < i; j++) {
+            const LoadedPlugin* earlier = hot[j].plugin;
+            if (earlier->wave >= plugin->wave && Plugin_UpdatesConflict(earlier->api, plugin->api)) {
+                plugin->wave = earlier->wave + 1;
+            }
+        }
+    }
+    PluginManager_SortHot(true);
+    for (size_t i = 0; i < g_hot.count; i++) {
+        hot[i].plugin->hot_index = (int)i;
+    }
+
+    ArenaArray_Clear(&g_waves);
+    for (size_t i = 0; i < g_hot.count; i++) {
+        PluginWave* wave = g_waves.count ? &ArenaArray_At(&g_waves, PluginWave, g_waves.count - 1) : NULL;
+        if (wave && hot[wave->start].plugin->wave == hot[i].plugin->wave) {
+            wave->count++;
+            continue;
+        }
+
+        wave = ArenaArray_PushType(&g_waves, PluginWave);
+        if (!wave) {
+            // Out of memory: leave the schedule dirty, UpdateAll falls back to one at a time
+            return;
+        }
+        wave->start = (uint32_t)i;
+        wave->count = 1;
+    }
+
+    g_schedule_dirty = false;
+    Platform_Log("Plugin update schedule: %zu plugins in %zu waves", g_hot.count, g_waves.count);
+}
+
+// ============================================================================
+// Lifetime
+// ============================================================================
 bool PluginManager_Init(void) {
     if (g_initialized) {
         Platform_LogWarning("Plugin manager already initialized");
         return true;
     }
 
-    memset(g_plugins, 0, sizeof(g_plugins));
+    g_manager_arena = Arena_CreateBump(Platform_GetRootArena(), PLUGIN_MANAGER_ARENA_SIZE, DEFAULT_ALIGNMENT);
+    if (!g_manager_arena) {
+        Platform_LogError("Failed to create plugin manager arena");
+        return false;
+    }
+    Arena_SetDebugName(g_manager_arena, "PluginManager");
+
+    RecordPool_Init(&g_loaded_records, "LoadedPlugin", sizeof(LoadedPlugin), _Alignof(LoadedPlugin));
+    RecordPool_Init(&g_platform_records, "PlatformPlugin", Platform_PluginRecordSize(), DEFAULT_ALIGNMENT);
+    g_plugins = ArenaArray_Init(g_manager_arena, LoadedPlugin*, PLUGIN_RECORD_CHUNK_MIN);
+    g_hot = ArenaArray_Init(g_manager_arena, PluginHot, PLUGIN_RECORD_CHUNK_MIN);
+    g_waves = ArenaArray_Init(g_manager_arena, PluginWave, PLUGIN_RECORD_CHUNK_MIN);
+    g_schedule_dirty = false;
     g_plugin_count = 0;
     g_initialized = true;
 
@@ -41,35 +302,65 @@ void PluginManager_Shutdown(void) {
     if (!g_initialized) return;
 
     // Unload all plugins in reverse order
-    for (int i = g_plugin_count - 1; i >= 0; i--) {
-        if (g_plugins[i].active) {
-            PluginManager_Unload(i);
+    for (size_t i = g_plugins.count; i-- > 0;) {
+        if (ArenaArray_At(&g_plugins, LoadedPlugin*, i)) {
+            PluginManager_Unload((int)i);
         }
     }
 
+    Arena_Destroy(g_manager_arena);
+    g_manager_arena = NULL;
     g_plugin_count = 0;
     g_initialized = false;
 
     Platform_Log("Plugin manager shutdown");
 }
 
+// Reuse the lowest free index so indices stay small and stable across unload/load
+static int PluginManager_AcquireIndex(void) {
+    for (size_t i = 0; i < g_plugins.count; i++) {
+        if (!ArenaArray_At(&g_plugins, LoadedPlugin*, i)) {
+            return (int)i;
+        }
+    }
+    if (!ArenaArray_Push(&g_plugins)) {
+        return -1;
+    }
+    ArenaArray_At(&g_plugins, LoadedPlugin*, g_plugins.count - 1) = NULL;
+    return (int)(g_plugins.count - 1);
+}
+
+// Undo a partially completed load
+static void PluginManager_FreePlugin(LoadedPlugin* plugin) {
+    if (plugin->handle) {
+        Platform_PluginUnload(plugin->handle);
+    }
+    RecordPool_Free(&g_loaded_records, plugin);
+}
+
 int PluginManager_Load(const char* path) {
     if (!g_initialized) {
         Platform_LogError("Plugin manager not initialized");
         return -1;
     }
 
-    if (g_plugin_count >= MAX_PLUGINS) {
-        Platform_LogError("Maximum plugins loaded (%d)", MAX_PLUGINS);
+    const int index = PluginManager_AcquireIndex();
+    LoadedPlugin* plugin = index >= 0 ? RecordPool_Alloc(&g_loaded_records) : NULL;
+    Arena* platform_chunk = plugin ? RecordPool_GetChunk(&g_platform_records) : NULL;
+    if (!platform_chunk) {
+        Platform_LogError("Failed to allocate plugin record: %s", path);
+        if (plugin) RecordPool_Free(&g_loaded_records, plugin);
         return -1;
     }
-
-    LoadedPlugin* plugin = &g_plugins[g_plugin_count];
+    memset(plugin, 0, sizeof(*plugin));
+    plugin->index = index;
+    plugin->hot_index = -1;
 
     // Load the DLL
-    plugin->handle = Platform_PluginLoad(path);
+    plugin->handle = Platform_PluginLoad(path, platform_chunk);
     if (!plugin->handle) {
         Platform_LogError("Failed to load plugin: %s", path);
+        PluginManager_FreePlugin(plugin);
         return -1;
     }
 
@@ -78,7 +369,7 @@ int PluginManager_Load(const char* path) {
     const GetAPIFunc get_api = (GetAPIFunc)Platform_PluginGetSymbol(plugin->handle, "GetPluginAPI");
     if (!get_api) {
         Platform_LogError("Plugin missing GetPluginAPI: %s", path);
-        Platform_PluginUnload(plugin->handle);
+        PluginManager_FreePlugin(plugin);
         return -1;
     }
 
@@ -86,24 +377,35 @@ int PluginManager_Load(const char* path) {
     plugin->api = get_api();
     if (!plugin->api) {
         Platform_LogError("GetPluginAPI returned NULL: %s", path);
-        Platform_PluginUnload(plugin->handle);
+        PluginManager_FreePlugin(plugin);
         return -1;
     }
 
+    // Fill the plugin's extension API cache before init, which may already call extensions
+    if (plugin->api->resolve_extensions) {
+        plugin->api->resolve_extensions(Engine_GetAPI());
+    }
+
     // Initialize the plugin
     if (plugin->api->init) {
         if (!plugin->api->init(&plugin->state, Platform_GetAPI(), Engine_GetAPI())) {
             Platform_LogError("Plugin init failed: %s", path);
-            Platform_PluginUnload(plugin->handle);
+            PluginManager_FreePlugin(plugin);
             return -1;
         }
     }
 
-    // Store path for reload checking
-    strncpy(plugin->path, path, sizeof(plugin->path) - 1);
-    plugin->active = true;
+    if (!PluginManager_Activate(plugin)) {
+        Platform_LogError("Plugin manager out of memory, unloading: %s", path);
+        if (plugin->api->shutdown && plugin->state) {
+            plugin->api->shutdown(&plugin->state);
+        }
+        PluginManager_FreePlugin(plugin);
+        return -1;
+    }
 
-    int index = g_plugin_count++;
+    ArenaArray_At(&g_plugins, LoadedPlugin*, index) = plugin;
+    g_plugin_count++;
 
     Platform_Log("Loaded plugin: %s (v%d) - %s",
                  plugin->api->name,
@@ -114,87 +416,240 @@ int PluginManager_Load(const char* path) {
 }
 
 void PluginManager_Unload(int plugin_index) {
-    if (plugin_index < 0 || plugin_index >= g_plugin_count) {
+    LoadedPlugin* plugin = NULL;
+    if (plugin_index >= 0 && (size_t)plugin_index < g_plugins.count) {
+        plugin = ArenaArray_At(&g_plugins, LoadedPlugin*, plugin_index);
+    }
+    if (!plugin) {
         Platform_LogError("Invalid plugin index: %d", plugin_index);
         return;
     }
 
-    LoadedPlugin* plugin = &g_plugins[plugin_index];
-    if (!plugin->active) return;
-
     Platform_Log("Unloading plugin: %s", plugin->api->name);
 
-    // Shutdown the plugin
+    PluginManager_Deactivate(plugin);
+
+    // Shutdown the plugin (a plugin disabled by a failed reload has no state left)
     if (plugin->api->shutdown && plugin->state) {
         plugin->api->shutdown(&plugin->state);
     }
 
-    // Unload the DLL
-    Platform_PluginUnload(plugin->handle);
+    // Unload the DLL; both records go back to their pools for the next load
+    PluginManager_FreePlugin(plugin);
+    ArenaArray_At(&g_plugins, LoadedPlugin*, plugin_index) = NULL;
+    g_plugin_count--;
+}
 
-    plugin->active = false;
-    plugin->api = NULL;
-    plugin->state = NULL;
-    plugin->handle = NULL;
+typedef struct {
+    const PluginHot* hot;
+    float delta_time;
+} PluginUpdateWave;
+
+static void PluginManager_UpdateTask(void* data, uint32_t index) {
+    const PluginUpdateWave* wave = data;
+    wave->hot[index].update(wave->hot[index].state, wave->delta_time);
 }
 
 void PluginManager_UpdateAll(float delta_time) {
-    for (int i = 0; i < g_plugin_count; i++) {
-        const LoadedPlugin* plugin = &g_plugins[i];
+    if (g_schedule_dirty) {
+        PluginManager_BuildSchedule();
+    }
 
-        if (!plugin->active || !plugin->api->update) continue;
+    const PluginHot* hot = (const PluginHot*)g_hot.data;
+    if (g_schedule_dirty) {
+        for (size_t i = 0, count = g_hot.count; i < count; i++) {
+            hot[i].update(hot[i].state, delta_time);
+        }
+        return;
+    }
 
-        plugin->api->update(plugin->state, delta_time);
+    // Single-plugin waves run inline on this thread; wider ones fan out to the worker pool
+    const PluginWave* waves = (const PluginWave*)g_waves.data;
+    for (size_t i = 0, count = g_waves.count; i < count; i++) {
+        PluginUpdateWave wave = {hot + waves[i].start, delta_time};
+        WorkerPool_Run(PluginManager_UpdateTask, &wave, waves[i].count);
     }
 }
 
 void PluginManager_RenderAll(void) {
-    for (int i = 0; i < g_plugin_count; i++) {
-        const LoadedPlugin* plugin = &g_plugins[i];
+    const PluginHot* hot = (const PluginHot*)g_hot.data;
+    for (size_t i = 0, count = g_hot.count; i < count; i++) {
+        hot[i].render(hot[i].state);
+    }
+}
 
-        if (!plugin->active || !plugin->api->render) continue;
+PluginRenderFrame* PluginManager_SnapshotAll(Arena* frame_arena) {
+    const PluginHot* hot = (const PluginHot*)g_hot.data;
+    const size_t count = g_hot.count;
+    PluginRenderFrame* frame = Arena_AllocAligned(frame_arena,
+                                                  sizeof(PluginRenderFrame) + count * sizeof(PluginRenderEntry),
+                                                  DEFAULT_ALIGNMENT);
+    if (!frame) {
+        Platform_LogError("Plugin manager: frame arena too small for the render snapshot");
+        return NULL;
+    }
 
-        plugin->api->render(plugin->state);
+    frame->count = count;
+    for (size_t i = 0; i < count; i++) {
+        const PluginAPI* api = hot[i].plugin->api;
+        PluginRenderEntry* entry = &frame->entries[i];
+        entry->render = api->render_snapshot;
+        entry->data = api->snapshot && api->render_snapshot ? api->snapshot(hot[i].state, frame_arena) : NULL;
+        if (!entry->data) {
+            entry->render = NULL;
+        }
     }
+    return frame;
 }
 
-void PluginManager_CheckReloadAll(void) {
-    for (int i = 0; i < g_plugin_count; i++) {
-        LoadedPlugin* plugin = &g_plugins[i];
+void PluginManager_RenderSnapshotAll(const PluginRenderFrame* frame) {
+    if (!frame) return;
 
-        if (!plugin->active) continue;
+    for (size_t i = 0; i < frame->count; i++) {
+        if (frame->entries[i].render) {
+            frame->entries[i].render(frame->entries[i].data);
+        }
+    }
+}
 
-        // Check if plugin DLL changed
-        if (Platform_PluginNeedsReload(plugin->handle)) {
-            Platform_Log("Reloading plugin: %s", plugin->api->name);
+bool PluginManager_CanPipeline(void) {
+    const PluginHot* hot = (const PluginHot*)g_hot.data;
+    for (size_t i = 0, count = g_hot.count; i < count; i++) {
+        const PluginAPI* api = hot[i].plugin->api;
+        if (!api->snapshot || !api->render_snapshot) {
+            return false;
+        }
+    }
+    return true;
+}
 
-            // Save state pointer (survives reload)
-            void* saved_state = plugin->state;
+// Carry the plugin's state across a reload that changed its layout. Both builds are loaded at
+// this point, so the old build can still read (or shut down) the old layout.
+// Returns false if the plugin couldn't be brought back up with the new build.
+static bool PluginManager_MigrateState(LoadedPlugin* plugin, const PluginAPI* old_api, PluginAPI* new_api) {
+    if (new_api->state_version == old_api->state_version) {
+        return true;
+    }
 
-            // Reload the DLL
-            if (!Platform_PluginReload(plugin->handle)) {
-                Platform_LogError("Failed to reload plugin: %s", plugin->path);
-                continue;
+    Platform_Log("Plugin state layout changed: %s (v%u -> v%u)",
+                 Platform_PluginGetPath(plugin->handle), old_api->state_version, new_api->state_version);
+
+    // Migrate into a fresh allocation in the plugin's own arena rather than restarting
+    if (new_api->migrate_state && new_api->state_size && old_api->get_state_arena && plugin->state) {
+        Arena* arena = old_api->get_state_arena(plugin->state);
+        void* new_state = arena ? Arena_AllocAligned(arena, new_api->state_size, DEFAULT_ALIGNMENT) : NULL;
+        if (new_state) {
+            memset(new_state, 0, new_api->state_size);
+            if (new_api->migrate_state(new_state, plugin->state, old_api->state_version)) {
+                // The old copy stays in the arena until the plugin resets or destroys it
+                plugin->state = new_state;
+                Platform_Log("Plugin state migrated: %s", Platform_PluginGetPath(plugin->handle));
+                return true;
             }
+        }
+        Platform_LogWarning("State migration failed, restarting plugin: %s", Platform_PluginGetPath(plugin->handle));
+    } else {
+        Platform_LogWarning("No state migration provided, restarting plugin: %s", Platform_PluginGetPath(plugin->handle));
+    }
 
-            // Get new API
-            typedef PluginAPI* (*GetAPIFunc)(void);
-            const GetAPIFunc get_api = (GetAPIFunc)Platform_PluginGetSymbol(plugin->handle, "GetPluginAPI");
-            if (!get_api) {
-                Platform_LogError("Plugin missing GetPluginAPI after reload");
-                continue;
-            }
+    // Restart: shut down with the code that understands the old layout, init with the new
+    if (old_api->shutdown && plugin->state) {
+        old_api->shutdown(&plugin->state);
+    }
+    plugin->state = NULL;
+
+    if (new_api->init && !new_api->init(&plugin->state, Platform_GetAPI(), Engine_GetAPI())) {
+        Platform_LogError("Plugin init failed after reload: %s", Platform_PluginGetPath(plugin->handle));
+        return false;
+    }
+    return true;
+}
+
+// Swap a staged build in at the frame boundary. The old build is still loaded until the
+// next reload, so any failure here reverts to it and the game carries on unchanged.
+static void PluginManager_SwapReloaded(LoadedPlugin* plugin) {
+    const uint64_t swap_start = Platform_GetTicksNS();
+    if (!Platform_PluginSwapReload(plugin->handle)) {
+        return;
+    }
+
+    // Get new API
+    typedef PluginAPI* (*GetAPIFunc)(void);
+    const GetAPIFunc get_api = (GetAPIFunc)Platform_PluginGetSymbol(plugin->handle, "GetPluginAPI");
+    PluginAPI* api = get_api ? get_api() : NULL;
+    if (!api) {
+        Platform_LogError("Plugin missing GetPluginAPI after reload, keeping previous build: %s", Platform_PluginGetPath(plugin->handle));
+        Platform_PluginRevertReload(plugin->handle);
+        return;
+    }
+    const uint64_t resolved = Platform_GetTicksNS();
+
+    api->platform = Platform_GetAPI();
+    api->engine = Engine_GetAPI();
+
+    // The new image's extension cache starts out empty: resolve it again
+    if (api->resolve_extensions) {
+        api->resolve_extensions(Engine_GetAPI());
+    }
 
-            plugin->api = get_api();
-            plugin->state = saved_state;  // Restore state pointer
-            plugin->api->platform = Platform_GetAPI();
-            plugin->api->engine = Engine_GetAPI();
+    // State pointer survives the reload untouched, unless its layout changed
+    PluginAPI* old_api = plugin->api;
+    if (!PluginManager_MigrateState(plugin, old_api, api)) {
+        // The state is gone by now: bring the old build back up from scratch
+        Platform_PluginRevertReload(plugin->handle);
+        plugin->state = NULL;
+        if (old_api->init && !old_api->init(&plugin->state, Platform_GetAPI(), Engine_GetAPI())) {
+            Platform_LogError("Plugin init failed after revert, disabling: %s", Platform_PluginGetPath(plugin->handle));
+            PluginManager_Deactivate(plugin);
+            return;
+        }
+        PluginManager_SyncHot(plugin);
+        return;
+    }
+    plugin->api = api;
+    PluginManager_SyncHot(plugin);
+
+    const uint64_t reinitialized = Platform_GetTicksNS();
+
+    Platform_Log("Plugin reloaded: %s (v%d), main thread stalled %.3f ms (symbols %.3f ms, re-init %.3f ms)",
+                 plugin->api->name,
+                 plugin->api->version,
+                 (double)(reinitialized - swap_start) / 1000000.0,
+                 (double)(resolved - swap_start) / 1000000.0,
+                 (double)(reinitialized - resolved) / 1000000.0);
+}
 
-            Platform_Log("Plugin reloaded: %s (v%d)",
-                         plugin->api->name,
-                         plugin->api->version);
+bool PluginManager_CheckReloadAll(void) {
+    bool swapped = false;
+    for (size_t i = 0; i < g_plugins.count; i++) {
+        LoadedPlugin* plugin = ArenaArray_At(&g_plugins, LoadedPlugin*, i);
+
+        // Skip free slots and plugins disabled by a failed reload
+        if (!plugin || plugin->hot_index < 0) continue;
+
+        // Copy/load happens on a background thread (logs its own timings); the old build keeps running
+        switch (Platform_PluginGetReloadStatus(plugin->handle)) {
+            case PLATFORM_PLUGIN_RELOAD_LOADING:
+                break;
+
+            case PLATFORM_PLUGIN_RELOAD_READY:
+                PluginManager_SwapReloaded(plugin);
+                swapped = true;
+                break;
+
+            case PLATFORM_PLUGIN_RELOAD_FAILED:
+                Platform_LogError("Failed to reload plugin, keeping current build: %s", Platform_PluginGetPath(plugin->handle));
+                break;
+
+            case PLATFORM_PLUGIN_RELOAD_IDLE:
+                // Check if plugin DLL changed
+                if (Platform_PluginNeedsReload(plugin->handle)) {
+                    Platform_PluginBeginReload(plugin->handle);
+                }
+                break;
         }
     }
+    return swapped;
 }
 
 int PluginManager_GetCount(void) {
@@ -1,11 +1,22 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
 #include "extension.h"
+#include "extension_manifest_generated.h"
 #include <stddef.h> // for NULL
 
-extern ExtensionInterface g_extension_test;
-
 void Engine_RegisterExtension(ExtensionInterface* ext);
 
+// Every compiled-in extension, generated by the extensions/ scan (tools/manifest_gen.c). Indexed by
+// the generated EXTENSION_ID_* constants, which is what registering in this order guarantees.
+#define EXTENSION_MANIFEST_ENTRY(id, ext) [id] = &ext,
+static ExtensionInterface* const g_extension_manifest[EXTENSION_COUNT > 0 ? EXTENSION_COUNT : 1] = {
+  EXTENSION_MANIFEST(EXTENSION_MANIFEST_ENTRY)
+};
+#undef EXTENSION_MANIFEST_ENTRY
+
 void Engine_LoadStaticExtensions(void) {
-  // TEMPORARY: All extensions to be included get added here.
-  Engine_RegisterExtension(&g_extension_test);
-}
\ No newline at end of file
+  for (int i = 0; i < EXTENSION_COUNT; ++i) {
+    Engine_RegisterExtension(g_extension_manifest[i]);
+  }
+}
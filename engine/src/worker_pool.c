@@ -0,0 +1,144 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#include "worker_pool.h"
+#include "platform.h"
+#include "platform_atomic.h"
+#include "platform_thread.h"
+
+#define WORKER_POOL_MAX_WORKERS 63
+
+// The batch in flight. Written by WorkerPool_Run before workers are woken and left alone
+// until every woken worker has checked back in, so workers read it without atomics.
+typedef struct WorkerBatch {
+  WorkerPoolTask task;
+  void* data;
+  uint32_t count;
+  volatile size_t next_index; // Next unclaimed index (fetch-add)
+} WorkerBatch;
+
+static PlatformThread* g_workers[WORKER_POOL_MAX_WORKERS];
+static uint32_t g_worker_count = 0;
+static PlatformSemaphore* g_work_ready = NULL; // One post per worker to wake
+static PlatformSemaphore* g_work_done = NULL;  // One post per woken worker once it runs dry
+static WorkerBatch g_batch;
+static volatile size_t g_quit = 0;
+
+// Claim and run indices until the batch is exhausted
+static void WorkerPool_Drain(void) {
+  for (;;) {
+    size_t index = Platform_AtomicFetchAddSize(&g_batch.next_index, 1);
+    if (index >= g_batch.count)
+      break;
+    g_batch.task(g_batch.data, (uint32_t)index);
+  }
+}
+
+static int WorkerPool_WorkerMain(void* data) {
+  (void)data;
+
+  for (;;) {
+    Platform_SemaphoreWait(g_work_ready);
+    if (Platform_AtomicLoadSize(&g_quit))
+      break;
+
+    WorkerPool_Drain();
+    Platform_SemaphorePost(g_work_done, 1);
+  }
+
+  Arena_ReleaseThreadScratch();
+  return 0;
+}
+
+// ============================================================================
+// Lifetime
+// ============================================================================
+bool WorkerPool_Init(uint32_t worker_count) {
+  if (g_work_ready) {
+    Platform_LogWarning("Worker pool already initialized");
+    return true;
+  }
+
+  if (worker_count == 0) {
+    // Half the cores beyond the calling thread; the job system's threads default to the other half
+    uint32_t cpus = Platform_GetCPUCount();
+    worker_count = cpus > 1 ? (cpus - 1) / 2 : 0;
+  }
+  if (worker_count > WORKER_POOL_MAX_WORKERS) {
+    worker_count = WORKER_POOL_MAX_WORKERS;
+  }
+
+  g_work_ready = Platform_SemaphoreCreate(0);
+  g_work_done = Platform_SemaphoreCreate(0);
+  if (!g_work_ready || !g_work_done) {
+    Platform_LogError("Failed to create worker pool semaphores");
+    WorkerPool_Shutdown();
+    return false;
+  }
+
+  g_quit = 0;
+  g_worker_count = 0;
+  for (uint32_t i = 0; i < worker_count; ++i) {
+    g_workers[i] = Platform_ThreadCreate(WorkerPool_WorkerMain, "flight_worker", NULL);
+    if (!g_workers[i]) {
+      // Run with what we have; WorkerPool_Run works with any count, including none
+      Platform_LogWarning("Worker pool started %u of %u workers", i, worker_count);
+      break;
+    }
+    g_worker_count++;
+  }
+
+  Platform_Log("Worker pool initialized: %u workers", g_worker_count);
+  return true;
+}
+
+void WorkerPool_Shutdown(void) {
+  Platform_AtomicStoreSize(&g_quit, 1);
+  if (g_work_ready) {
+    Platform_SemaphorePost(g_work_ready, g_worker_count);
+  }
+  for (uint32_t i = 0; i < g_worker_count; ++i) {
+    Platform_ThreadJoin(g_workers[i]);
+    g_workers[i] = NULL;
+  }
+  g_worker_count = 0;
+
+  Platform_SemaphoreDestroy(g_work_ready);
+  Platform_SemaphoreDestroy(g_work_done);
+  g_work_ready = NULL;
+  g_work_done = NULL;
+}
+
+uint32_t WorkerPool_GetWorkerCount(void) {
+  return g_worker_count;
+}
+
+// ============================================================================
+// Batches
+// ============================================================================
+void WorkerPool_Run(WorkerPoolTask task, void* data, uint32_t count) {
+  if (!task || count == 0)
+    return;
+
+  // No point waking anyone for a single task
+  uint32_t wake = count - 1 < g_worker_count ? count - 1 : g_worker_count;
+  if (wake == 0) {
+    for (uint32_t i = 0; i < count; ++i) {
+      task(data, i);
+    }
+    return;
+  }
+
+  g_batch.task = task;
+  g_batch.data = data;
+  g_batch.count = count;
+  Platform_AtomicStoreSize(&g_batch.next_index, 0);
+
+  Platform_SemaphorePost(g_work_ready, wake);
+  WorkerPool_Drain();
+
+  // Every woken worker must be done with g_batch before it can be reused
+  for (uint32_t i = 0; i < wake; ++i) {
+    Platform_SemaphoreWait(g_work_done);
+  }
+}
@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+//
+// Chase-Lev deque, after Le, Pop, Cohen & Zappa Nardelli, "Correct and Efficient Work-Stealing
+// for Weak Memory Models" (PPoPP 2013). top and bottom only ever grow; a slot is index & mask.
+
+#include "jobs_internal.h"
+#include "platform_atomic.h"
+
+#define JOBS_DEQUE_MASK (JOBS_DEQUE_CAPACITY - 1)
+
+typedef char JobDequeCapacityIsPowerOfTwo[(JOBS_DEQUE_CAPACITY & JOBS_DEQUE_MASK) == 0 ? 1 : -1];
+
+void JobDeque_Init(JobDeque *deque) {
+  deque->top = 0;
+  deque->bottom = 0;
+}
+
+bool JobDeque_Push(JobDeque *deque, Job *job) {
+  size_t bottom = deque->bottom; // Only the owner writes bottom
+  size_t top = Platform_AtomicLoadSize(&deque->top);
+  if (bottom - top >= JOBS_DEQUE_CAPACITY)
+    return false;
+
+  Platform_AtomicStoreSize(&deque->slots[bottom & JOBS_DEQUE_MASK], (size_t)job);
+  Platform_AtomicStoreSize(&deque->bottom, bottom + 1); // Publishes the slot to thieves
+  return true;
+}
+
+Job *JobDeque_Pop(JobDeque *deque) {
+  size_t bottom = deque->bottom - 1;
+  Platform_AtomicStoreSize(&deque->bottom, bottom);
+  Platform_AtomicFence(); // The bottom store must land before we read top (a thief does the reverse)
+  size_t top = Platform_AtomicLoadSize(&deque->top);
+
+  if ((ptrdiff_t)(bottom - top) < 0) {
+    // Empty
+    Platform_AtomicStoreSize(&deque->bottom, bottom + 1);
+    return NULL;
+  }
+
+  Job *job = (Job *)Platform_AtomicLoadSize(&deque->slots[bottom & JOBS_DEQUE_MASK]);
+  if (bottom == top) {
+    // Last job: race the thieves for it through top
+    if (!Platform_AtomicCompareExchangeSize(&deque->top, &top, top + 1)) {
+      job = NULL;
+    }
+    Platform_AtomicStoreSize(&deque->bottom, bottom + 1);
+  }
+  return job;
+}
+
+Job *JobDeque_Steal(JobDeque *deque) {
+  size_t top = Platform_AtomicLoadSize(&deque->top);
+  Platform_AtomicFence();
+  size_t bottom = Platform_AtomicLoadSize(&deque->bottom);
+
+  if ((ptrdiff_t)(bottom - top) <= 0)
+    return NULL;
+
+  // Read before claiming: once top moves the owner may reuse the slot
+  Job *job = (Job *)Platform_AtomicLoadSize(&deque->slots[top & JOBS_DEQUE_MASK]);
+  if (!Platform_AtomicCompareExchangeSize(&deque->top, &top, top + 1))
+    return NULL;
+  return job;
+}
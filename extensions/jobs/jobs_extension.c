@@ -0,0 +1,794 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+//
+// Work-stealing job system. Each job thread owns a Chase-Lev deque (jobs_deque.c) and a block
+// arena of Job records; idle threads steal from the top of the others' deques. Threads that
+// aren't job threads (main, render, loaders) share one mutex-guarded injection queue and help
+// run jobs while they Jobs_Wait, so no thread ever blocks on work it could be doing itself.
+
+#include "jobs_types.h"
+#include "jobs_extension_api.h"
+#include "engine_api.h"
+#include "extension.h"
+#include "jobs_internal.h"
+#include "platform_api.h"
+#include "platform_atomic.h"
+#include <stdio.h>
+
+#if defined(_MSC_VER)
+#define JOBS_THREAD_LOCAL __declspec(thread)
+#else
+#define JOBS_THREAD_LOCAL _Thread_local
+#endif
+
+// Job threads started at init (0 = the CPU cores beyond the main thread that the engine's worker
+// pool doesn't use)
+#ifndef JOBS_WORKER_COUNT
+#define JOBS_WORKER_COUNT 0
+#endif
+
+#define JOBS_MAX_WORKERS 63
+#define JOBS_POOL_CAPACITY 4096     // Job records per thread before submits start running inline
+#define JOBS_SPIN_ROUNDS 256        // Empty searches before an idle thread sleeps
+#define JOBS_CHUNKS_PER_THREAD 4    // ParallelFor's automatic grain aims for this many chunks each
+#define JOBS_COUNTER_LOCK 0x80000000u
+#define JOBS_EXTERNAL 0             // Context shared by every thread that isn't a job thread
+
+// Per-thread scheduling state: slot 0 is the shared external context, 1..N the job threads
+typedef struct JobWorker {
+  JobDeque deque;              // Job threads only; external submits go to the injection queue
+  Arena *arena;                // Owns this record and the pool
+  Arena *pool;                 // Block arena of Job records, allocated from only by this context
+  volatile size_t remote_free; // Our records that other threads ran (lock-free stack)
+  uint32_t live;               // Records allocated and not yet back in pool
+  uint32_t index;
+  PlatformThread *thread;
+  volatile size_t executed;
+  volatile size_t stolen;
+  volatile size_t inlined;
+} JobWorker;
+
+static PlatformAPI *g_platform = NULL;
+static JobWorker *g_contexts[JOBS_MAX_WORKERS + 1];
+static volatile uint32_t g_worker_count = 0;
+
+// Injection queue (FIFO) for jobs from external threads; g_external_lock also guards the
+// external context's pool
+static PlatformMutex *g_external_lock = NULL;
+static Job *g_inject_head = NULL;
+static Job *g_inject_tail = NULL;
+static volatile size_t g_injected = 0; // Queue length, read without the lock as a hint
+
+// Idle job threads sleep on g_work_epoch; every submit bumps it and wakes them if any sleep
+static volatile uint32_t g_work_epoch = 0;
+static volatile uint32_t g_sleepers = 0;
+static volatile uint32_t g_quit = 0;
+
+static JOBS_THREAD_LOCAL JobWorker *t_worker = NULL;
+static JOBS_THREAD_LOCAL uint32_t t_random = 0;
+
+static JobWorker *Jobs_Self(void) {
+  return t_worker ? t_worker : g_contexts[JOBS_EXTERNAL];
+}
+
+static bool Jobs_IsExternal(const JobWorker *self) {
+  return self->index == JOBS_EXTERNAL;
+}
+
+// Stats are plain increments on a job thread; external threads share their context
+static void Jobs_CountStat(JobWorker *self, volatile size_t *stat) {
+  if (Jobs_IsExternal(self)) {
+    Platform_AtomicFetchAddSize(stat, 1);
+  } else {
+    *stat += 1;
+  }
+}
+
+// xorshift32, seeded per thread: spreads thieves over different victims
+static uint32_t Jobs_Random(void) {
+  uint32_t x = t_random;
+  if (x == 0) {
+    x = (uint32_t)(g_platform->GetThreadID() * 2654435761u) | 1u;
+  }
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  t_random = x;
+  return x;
+}
+
+// ============================================================================
+// Job Records
+// ============================================================================
+// Take back every record of ours that another thread ran
+static void Jobs_ReclaimRemote(JobWorker *worker) {
+  size_t head = Platform_AtomicLoadSize(&worker->remote_free);
+  while (head && !Platform_AtomicCompareExchangeSize(&worker->remote_free, &head, 0)) {
+  }
+
+  for (Job *job = (Job *)head; job;) {
+    Job *next = job->next;
+    g_platform->ArenaFree(worker->pool, job);
+    worker->live--;
+    job = next;
+  }
+}
+
+// Owner only (external: with g_external_lock held). NULL when the pool is exhausted.
+static Job *Jobs_NewJob(JobWorker *self) {
+  if (self->live == JOBS_POOL_CAPACITY) {
+    Jobs_ReclaimRemote(self);
+    if (self->live == JOBS_POOL_CAPACITY)
+      return NULL;
+  }
+
+  Job *job = g_platform->ArenaAlloc(self->pool, sizeof(Job));
+  if (job) {
+    self->live++;
+  }
+  return job;
+}
+
+// Any thread. A job thread returns its own records straight to its pool; everything else goes
+// on the owner's remote list, which the owner drains when it runs out.
+static void Jobs_FreeJob(JobWorker *self, Job *job) {
+  JobWorker *owner = g_contexts[job->owner];
+  if (owner == self && !Jobs_IsExternal(self)) {
+    g_platform->ArenaFree(self->pool, job);
+    self->live--;
+    return;
+  }
+
+  size_t head = Platform_AtomicLoadSize(&owner->remote_free);
+  do {
+    job->next = (Job *)head;
+  } while (!Platform_AtomicCompareExchangeSize(&owner->remote_free, &head, (size_t)job));
+}
+
+// ============================================================================
+// Queues
+// ============================================================================
+static void Jobs_Signal(uint32_t count) {
+  Platform_AtomicFetchAddU32(&g_work_epoch, 1);
+  Platform_AtomicFence(); // Pairs with the fence in Jobs_WorkerMain: either we see the sleeper or it sees the new epoch
+  if (Platform_AtomicLoadU32(&g_sleepers)) {
+    g_platform->WakeOnAddress(&g_work_epoch, count > 1);
+  }
+}
+
+// Queue on the calling thread: its own deque, or the injection queue (external: lock held).
+// False when the deque is full.
+static bool Jobs_Push(JobWorker *self, Job *job) {
+  if (!Jobs_IsExternal(self))
+    return JobDeque_Push(&self->deque, job);
+
+  job->next = NULL;
+  if (g_inject_tail) {
+    g_inject_tail->next = job;
+  } else {
+    g_inject_head = job;
+  }
+  g_inject_tail = job;
+  Platform_AtomicStoreSize(&g_injected, g_injected + 1);
+  return true;
+}
+
+// Copy desc into a new record and queue it. False = no room, the caller runs it instead.
+static bool Jobs_Enqueue(JobWorker *self, const Job *desc) {
+  bool external = Jobs_IsExternal(self);
+  if (external) {
+    g_platform->MutexLock(g_external_lock);
+  }
+
+  bool queued = false;
+  Job *job = Jobs_NewJob(self);
+  if (job) {
+    *job = *desc;
+    job->owner = self->index;
+    job->next = NULL;
+    queued = Jobs_Push(self, job);
+    if (!queued) {
+      g_platform->ArenaFree(self->pool, job);
+      self->live--;
+    }
+  }
+
+  if (external) {
+    g_platform->MutexUnlock(g_external_lock);
+  }
+  return queued;
+}
+
+static Job *Jobs_PopInjected(void) {
+  if (!Platform_AtomicLoadSize(&g_injected))
+    return NULL;
+
+  g_platform->MutexLock(g_external_lock);
+  Job *job = g_inject_head;
+  if (job) {
+    g_inject_head = job->next;
+    if (!g_inject_head) {
+      g_inject_tail = NULL;
+    }
+    Platform_AtomicStoreSize(&g_injected, g_injected - 1);
+  }
+  g_platform->MutexUnlock(g_external_lock);
+  return job;
+}
+
+// Own deque first (newest, still in cache), then the injection queue, then steal
+static Job *Jobs_FindWork(JobWorker *self) {
+  Job *job = NULL;
+  if (!Jobs_IsExternal(self)) {
+    job = JobDeque_Pop(&self->deque);
+    if (job)
+      return job;
+  }
+
+  job = Jobs_PopInjected();
+  if (job)
+    return job;
+
+  uint32_t count = Platform_AtomicLoadU32(&g_worker_count);
+  if (count == 0)
+    return NULL;
+
+  uint32_t start = Jobs_Random() % count;
+  for (uint32_t i = 0; i < count; ++i) {
+    JobWorker *victim = g_contexts[1 + (start + i) % count];
+    if (victim == self)
+      continue;
+
+    job = JobDeque_Steal(&victim->deque);
+    if (job) {
+      Jobs_CountStat(self, &self->stolen);
+      return job;
+    }
+  }
+  return NULL;
+}
+
+// ============================================================================
+// Counters
+// ============================================================================
+static void Jobs_Execute(JobWorker *self, Job *job);
+
+// Queue a detached continuation list (Jobs_RunAfter jobs whose dependency just reached zero)
+static void Jobs_Schedule(JobWorker *self, Job *list) {
+  bool external = Jobs_IsExternal(self);
+  uint32_t queued = 0;
+
+  while (list) {
+    Job *next = list->next;
+    if (external) {
+      g_platform->MutexLock(g_external_lock);
+    }
+    bool pushed = Jobs_Push(self, list);
+    if (external) {
+      g_platform->MutexUnlock(g_external_lock);
+    }
+
+    if (pushed) {
+      queued++;
+    } else {
+      Jobs_CountStat(self, &self->inlined);
+      Jobs_Execute(self, list);
+    }
+    list = next;
+  }
+
+  if (queued) {
+    Jobs_Signal(queued);
+  }
+}
+
+// One job of counter finished. The last one takes the lock bit instead of writing zero, so
+// waiters (who may free the counter the moment they see zero) only see it once the
+// continuations are detached; clearing the bit is the final touch.
+static void Jobs_CounterDone(JobWorker *self, JobCounter *counter) {
+  uint32_t value = Platform_AtomicLoadU32(&counter->value);
+  for (;;) {
+    if (value == 1) {
+      if (Platform_AtomicCompareExchangeU32(&counter->value, &value, JOBS_COUNTER_LOCK))
+        break;
+    } else if (value == (JOBS_COUNTER_LOCK | 1)) {
+      // Jobs_RunAfter (or a previous last job) holds the lock
+      Platform_CPURelax();
+      value = Platform_AtomicLoadU32(&counter->value);
+    } else if (Platform_AtomicCompareExchangeU32(&counter->value, &value, value - 1)) {
+      return;
+    }
+  }
+
+  Job *continuations = counter->continuations;
+  counter->continuations = NULL;
+
+  // Jobs_Run may have added to the count meanwhile: keep it, drop the bit
+  value = JOBS_COUNTER_LOCK;
+  while (!Platform_AtomicCompareExchangeU32(&counter->value, &value, value & ~JOBS_COUNTER_LOCK)) {
+  }
+
+  // Only hashes the address, so it's fine if a waiter has already released the counter
+  g_platform->WakeOnAddress(&counter->value, true);
+
+  if (continuations) {
+    Jobs_Schedule(self, continuations);
+  }
+}
+
+// ============================================================================
+// Execution
+// ============================================================================
+// Queue [begin, end) of a range job as a new job. False = no room.
+static bool Jobs_SpawnRange(JobWorker *self, const Job *parent, uint32_t begin, uint32_t end) {
+  Job desc = *parent;
+  desc.begin = begin;
+  desc.end = end;
+
+  // Count it before anyone can run it; the parent is still outstanding, so undoing can't reach zero
+  if (desc.counter) {
+    Platform_AtomicFetchAddU32(&desc.counter->value, 1);
+  }
+  if (!Jobs_Enqueue(self, &desc)) {
+    if (desc.counter) {
+      Platform_AtomicFetchAddU32(&desc.counter->value, (uint32_t)-1);
+    }
+    return false;
+  }
+
+  Jobs_Signal(1);
+  return true;
+}
+
+static void Jobs_Execute(JobWorker *self, Job *job) {
+  if (job->range_func) {
+    // Split off the upper half until one chunk is left: thieves take the oldest, biggest halves
+    while (job->end - job->begin > job->grain) {
+      uint32_t mid = job->begin + (job->end - job->begin) / 2;
+      if (!Jobs_SpawnRange(self, job, mid, job->end))
+        break; // Out of room: run the rest here
+      job->end = mid;
+    }
+    job->range_func(job->data, job->begin, job->end);
+  } else {
+    job->func(job->data);
+  }
+
+  Jobs_CountStat(self, &self->executed);
+
+  JobCounter *counter = job->counter;
+  Jobs_FreeJob(self, job);
+  if (counter) {
+    Jobs_CounterDone(self, counter);
+  }
+}
+
+// ============================================================================
+// Job Threads
+// ============================================================================
+static int Jobs_WorkerMain(void *data) {
+  JobWorker *self = (JobWorker *)data;
+  t_worker = self;
+
+  uint32_t idle = 0;
+  while (!Platform_AtomicLoadU32(&g_quit)) {
+    uint32_t epoch = Platform_AtomicLoadU32(&g_work_epoch);
+    Job *job = Jobs_FindWork(self);
+    if (job) {
+      Jobs_Execute(self, job);
+      idle = 0;
+      continue;
+    }
+
+    if (++idle < JOBS_SPIN_ROUNDS) {
+      Platform_CPURelax();
+      continue;
+    }
+
+    // Nothing anywhere: announce the sleep, then sleep only if no submit has happened since the search
+    Platform_AtomicFetchAddU32(&g_sleepers, 1);
+    Platform_AtomicFence();
+    if (Platform_AtomicLoadU32(&g_work_epoch) == epoch && !Platform_AtomicLoadU32(&g_quit)) {
+      g_platform->WaitOnAddress(&g_work_epoch, epoch, PLATFORM_WAIT_FOREVER);
+    }
+    Platform_AtomicFetchAddU32(&g_sleepers, (uint32_t)-1);
+    idle = 0;
+  }
+
+  g_platform->ArenaReleaseThreadScratch();
+  return 0;
+}
+
+// Scheduling state for slot index, in its own arena so Jobs_Shutdown can hand it all back
+static JobWorker *Jobs_CreateContext(uint32_t index) {
+  size_t pool_size = (size_t)JOBS_POOL_CAPACITY * (sizeof(Job) + DEFAULT_ALIGNMENT) + KILOBYTES(4);
+  size_t arena_size = sizeof(JobWorker) + JOBS_CACHE_LINE + pool_size;
+
+  Arena *arena = g_platform->ArenaCreateBump(g_platform->GetRootArena(), arena_size, DEFAULT_ALIGNMENT);
+  if (!arena)
+    return NULL;
+  g_platform->ArenaSetDebugName(arena, index == JOBS_EXTERNAL ? "Jobs::External" : "Jobs::Worker");
+
+  JobWorker *worker = g_platform->ArenaAllocAligned(arena, sizeof(JobWorker), JOBS_CACHE_LINE);
+  Arena *pool = worker ? g_platform->ArenaCreateBlock(arena, sizeof(Job), JOBS_POOL_CAPACITY, DEFAULT_ALIGNMENT) : NULL;
+  if (!pool) {
+    g_platform->ArenaDestroy(arena);
+    return NULL;
+  }
+  g_platform->ArenaSetDebugName(pool, "Jobs::Pool");
+
+  JobDeque_Init(&worker->deque);
+  worker->arena = arena;
+  worker->pool = pool;
+  worker->remote_free = 0;
+  worker->live = 0;
+  worker->index = index;
+  worker->thread = NULL;
+  worker->executed = 0;
+  worker->stolen = 0;
+  worker->inlined = 0;
+  return worker;
+}
+
+static void Jobs_StopWorkers(void) {
+  uint32_t count = g_worker_count;
+  if (count == 0)
+    return;
+
+  Platform_AtomicStoreU32(&g_quit, 1);
+  Platform_AtomicFetchAddU32(&g_work_epoch, 1);
+  g_platform->WakeOnAddress(&g_work_epoch, true);
+  for (uint32_t i = 1; i <= count; ++i) {
+    g_platform->ThreadJoin(g_contexts[i]->thread);
+    g_contexts[i]->thread = NULL;
+  }
+  Platform_AtomicStoreU32(&g_worker_count, 0);
+  Platform_AtomicStoreU32(&g_quit, 0);
+
+  // Anything still queued runs here rather than being lost (range jobs split into the injection queue)
+  JobWorker *self = Jobs_Self();
+  Job *job;
+  for (uint32_t i = 1; i <= count; ++i) {
+    while ((job = JobDeque_Steal(&g_contexts[i]->deque)) != NULL) {
+      Jobs_Execute(self, job);
+    }
+  }
+  while ((job = Jobs_PopInjected()) != NULL) {
+    Jobs_Execute(self, job);
+  }
+}
+
+// ============================================================================
+// Jobs API
+// ============================================================================
+EXTENSION_API void Jobs_Run(const JobDecl *jobs, uint32_t count, JobCounter *counter) {
+  if (!jobs || count == 0)
+    return;
+
+  if (g_worker_count == 0) {
+    for (uint32_t i = 0; i < count; ++i) {
+      jobs[i].func(jobs[i].data);
+    }
+    return;
+  }
+
+  JobWorker *self = Jobs_Self();
+  if (counter) {
+    Platform_AtomicFetchAddU32(&counter->value, count);
+  }
+
+  uint32_t queued = 0;
+  for (uint32_t i = 0; i < count; ++i) {
+    Job desc = {.func = jobs[i].func, .data = jobs[i].data, .counter = counter};
+    if (Jobs_Enqueue(self, &desc)) {
+      queued++;
+      continue;
+    }
+
+    jobs[i].func(jobs[i].data);
+    Jobs_CountStat(self, &self->inlined);
+    if (counter) {
+      Jobs_CounterDone(self, counter);
+    }
+  }
+
+  if (queued) {
+    Jobs_Signal(queued);
+  }
+}
+
+EXTENSION_API void Jobs_RunAfter(const JobDecl *jobs, uint32_t count, JobCounter *counter, JobCounter *dependency) {
+  if (!jobs || count == 0)
+    return;
+
+  if (!dependency || g_worker_count == 0) {
+    if (dependency) {
+      Jobs_Wait(dependency);
+    }
+    Jobs_Run(jobs, count, counter);
+    return;
+  }
+
+  JobWorker *self = Jobs_Self();
+  if (counter) {
+    Platform_AtomicFetchAddU32(&counter->value, count);
+  }
+
+  // Build the records now; they're queued by whichever thread finishes the dependency
+  bool external = Jobs_IsExternal(self);
+  Job *head = NULL;
+  Job *tail = NULL;
+  uint32_t built = 0;
+  if (external) {
+    g_platform->MutexLock(g_external_lock);
+  }
+  for (; built < count; ++built) {
+    Job *job = Jobs_NewJob(self);
+    if (!job)
+      break;
+    *job = (Job){.func = jobs[built].func, .data = jobs[built].data, .counter = counter, .owner = self->index};
+    job->next = head;
+    head = job;
+    if (!tail) {
+      tail = job;
+    }
+  }
+  if (external) {
+    g_platform->MutexUnlock(g_external_lock);
+  }
+
+  if (head) {
+    uint32_t value = Platform_AtomicLoadU32(&dependency->value);
+    for (;;) {
+      if (value == 0) {
+        // Already finished: queue them now
+        Jobs_Schedule(self, head);
+        head = NULL;
+        break;
+      }
+      if (value & JOBS_COUNTER_LOCK) {
+        Platform_CPURelax();
+        value = Platform_AtomicLoadU32(&dependency->value);
+        continue;
+      }
+      if (Platform_AtomicCompareExchangeU32(&dependency->value, &value, value | JOBS_COUNTER_LOCK))
+        break;
+    }
+
+    if (head) {
+      tail->next = dependency->continuations;
+      dependency->continuations = head;
+
+      value = Platform_AtomicLoadU32(&dependency->value);
+      while (!Platform_AtomicCompareExchangeU32(&dependency->value, &value, value & ~JOBS_COUNTER_LOCK)) {
+      }
+    }
+  }
+
+  // Pool exhausted: the rest wait here and run inline
+  if (built < count) {
+    Jobs_Wait(dependency);
+    for (uint32_t i = built; i < count; ++i) {
+      jobs[i].func(jobs[i].data);
+      Jobs_CountStat(self, &self->inlined);
+      if (counter) {
+        Jobs_CounterDone(self, counter);
+      }
+    }
+  }
+}
+
+EXTENSION_API void Jobs_ParallelFor(JobRangeFunc func, void *data, uint32_t count, uint32_t grain, JobCounter *counter) {
+  if (!func || count == 0)
+    return;
+
+  uint32_t workers = Platform_AtomicLoadU32(&g_worker_count);
+  if (grain == 0) {
+    grain = count / ((workers + 1) * JOBS_CHUNKS_PER_THREAD);
+    if (grain == 0) {
+      grain = 1;
+    }
+  }
+
+  if (workers == 0 || count <= grain) {
+    func(data, 0, count);
+    return;
+  }
+
+  // One job for the whole range; whoever runs it splits it (Jobs_Execute)
+  JobWorker *self = Jobs_Self();
+  Job desc = {.range_func = func, .data = data, .begin = 0, .end = count, .grain = grain, .counter = counter};
+  if (counter) {
+    Platform_AtomicFetchAddU32(&counter->value, 1);
+  }
+  if (!Jobs_Enqueue(self, &desc)) {
+    Jobs_CountStat(self, &self->inlined);
+    func(data, 0, count);
+    if (counter) {
+      Jobs_CounterDone(self, counter);
+    }
+    return;
+  }
+  Jobs_Signal(1);
+}
+
+EXTENSION_API void Jobs_Wait(JobCounter *counter) {
+  if (!counter)
+    return;
+
+  JobWorker *self = Jobs_Self();
+  uint32_t idle = 0;
+  for (;;) {
+    uint32_t value = Platform_AtomicLoadU32(&counter->value);
+    if (value == 0)
+      return;
+
+    // Help instead of blocking
+    Job *job = Jobs_FindWork(self);
+    if (job) {
+      Jobs_Execute(self, job);
+      idle = 0;
+      continue;
+    }
+
+    if (++idle < JOBS_SPIN_ROUNDS) {
+      Platform_CPURelax();
+      continue;
+    }
+
+    // Everything left is running on other threads
+    g_platform->WaitOnAddress(&counter->value, value, PLATFORM_WAIT_FOREVER);
+    idle = 0;
+  }
+}
+
+EXTENSION_API bool Jobs_IsDone(const JobCounter *counter) {
+  return !counter || Platform_AtomicLoadU32(&counter->value) == 0;
+}
+
+EXTENSION_API uint32_t Jobs_GetThreadCount(void) {
+  return Platform_AtomicLoadU32(&g_worker_count) + 1;
+}
+
+EXTENSION_API uint32_t Jobs_GetThreadIndex(void) {
+  return t_worker ? t_worker->index : JOBS_EXTERNAL;
+}
+
+EXTENSION_API bool Jobs_SetWorkerCount(uint32_t count) {
+  if (!g_platform)
+    return false;
+
+  if (count > JOBS_MAX_WORKERS) {
+    count = JOBS_MAX_WORKERS;
+  }
+
+  Jobs_StopWorkers();
+
+  uint32_t started = 0;
+  for (uint32_t i = 1; i <= count; ++i) {
+    if (!g_contexts[i]) {
+      g_contexts[i] = Jobs_CreateContext(i);
+      if (!g_contexts[i])
+        break;
+    }
+
+    char name[32];
+    snprintf(name, sizeof(name), "flight_job_%u", i);
+    JobDeque_Init(&g_contexts[i]->deque);
+    g_contexts[i]->thread = g_platform->ThreadCreate(Jobs_WorkerMain, name, g_contexts[i]);
+    if (!g_contexts[i]->thread)
+      break;
+    started++;
+
+    // Published one at a time: a running worker only steals from started ones
+    Platform_AtomicStoreU32(&g_worker_count, started);
+  }
+
+  if (started < count) {
+    g_platform->LogWarning("Job system started %u of %u workers", started, count);
+    return false;
+  }
+  return true;
+}
+
+EXTENSION_API void Jobs_GetStats(JobStats *stats) {
+  if (!stats)
+    return;
+
+  *stats = (JobStats){0};
+  for (uint32_t i = 0; i <= JOBS_MAX_WORKERS; ++i) {
+    JobWorker *worker = g_contexts[i];
+    if (!worker)
+      continue;
+    stats->executed += Platform_AtomicLoadSize(&worker->executed);
+    stats->stolen += Platform_AtomicLoadSize(&worker->stolen);
+    stats->inlined += Platform_AtomicLoadSize(&worker->inlined);
+  }
+  stats->worker_count = Platform_AtomicLoadU32(&g_worker_count);
+}
+
+EXTENSION_API void Jobs_ResetStats(void) {
+  for (uint32_t i = 0; i <= JOBS_MAX_WORKERS; ++i) {
+    JobWorker *worker = g_contexts[i];
+    if (!worker)
+      continue;
+    Platform_AtomicStoreSize(&worker->executed, 0);
+    Platform_AtomicStoreSize(&worker->stolen, 0);
+    Platform_AtomicStoreSize(&worker->inlined, 0);
+  }
+}
+
+static JobsAPI g_jobs_api = {
+  .Run = Jobs_Run,
+  .RunAfter = Jobs_RunAfter,
+  .ParallelFor = Jobs_ParallelFor,
+  .Wait = Jobs_Wait,
+  .IsDone = Jobs_IsDone,
+  .GetThreadCount = Jobs_GetThreadCount,
+  .GetThreadIndex = Jobs_GetThreadIndex,
+  .SetWorkerCount = Jobs_SetWorkerCount,
+  .GetStats = Jobs_GetStats,
+  .ResetStats = Jobs_ResetStats
+};
+
+// ============================================================================
+// Extension Interface
+// ============================================================================
+void Jobs_Shutdown(void);
+
+bool Jobs_Init(EngineAPI *engine, PlatformAPI *platform) {
+  g_platform = platform;
+
+  g_external_lock = platform->MutexCreate();
+  g_contexts[JOBS_EXTERNAL] = g_external_lock ? Jobs_CreateContext(JOBS_EXTERNAL) : NULL;
+  if (!g_contexts[JOBS_EXTERNAL]) {
+    platform->LogError("Job system: failed to create the external context");
+    Jobs_Shutdown();
+    return false;
+  }
+
+  uint32_t count = JOBS_WORKER_COUNT;
+  if (count == 0) {
+    // The engine's pool threads sleep between batches but run plugin updates, which is where most
+    // jobs come from: only take the spare cores they leave, so the two never oversubscribe
+    uint32_t cpus = platform->GetCPUCount();
+    uint32_t spare = cpus > 1 ? cpus - 1 : 0;
+    uint32_t engine_workers = engine ? engine->GetWorkerCount() : 0;
+    count = spare > engine_workers ? spare - engine_workers : 0;
+  }
+  Jobs_SetWorkerCount(count);
+
+  platform->Log("Job system initialized: %u workers, %u jobs per thread", g_worker_count, JOBS_POOL_CAPACITY);
+  return true;
+}
+
+void Jobs_Shutdown(void) {
+  if (!g_platform)
+    return;
+
+  Jobs_StopWorkers();
+
+  for (uint32_t i = 0; i <= JOBS_MAX_WORKERS; ++i) {
+    if (g_contexts[i]) {
+      g_platform->ArenaDestroy(g_contexts[i]->arena);
+      g_contexts[i] = NULL;
+    }
+  }
+
+  g_platform->MutexDestroy(g_external_lock);
+  g_external_lock = NULL;
+  g_inject_head = NULL;
+  g_inject_tail = NULL;
+  g_injected = 0;
+}
+
+void *Jobs_GetSpecificAPI(void) {
+  return &g_jobs_api;
+}
+
+ExtensionInterface g_extension_jobs = {
+  .name = "Jobs",
+  .Init = Jobs_Init,
+  .Shutdown = Jobs_Shutdown,
+  .GetSpecificAPI = Jobs_GetSpecificAPI
+};
@@ -0,0 +1,55 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#ifndef JOBS_INTERNAL_H
+#define JOBS_INTERNAL_H
+
+#include "jobs_types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Jobs each worker can have queued in its deque (power of two)
+#ifndef JOBS_DEQUE_CAPACITY
+#define JOBS_DEQUE_CAPACITY 4096
+#endif
+
+#define JOBS_CACHE_LINE 64
+
+// One queued job. Allocated from the submitting thread's block arena and freed back to it
+// by whichever thread ran it.
+struct Job {
+  JobFunc func;
+  JobRangeFunc range_func; // Set for Jobs_ParallelFor chunks instead of func
+  void *data;
+  uint32_t begin;          // Range jobs: [begin, end), split in half down to grain
+  uint32_t end;
+  uint32_t grain;
+  uint32_t owner;          // Index of the JobWorker whose arena this came from
+  JobCounter *counter;     // Decremented once the job (or chunk) has run; NULL = nobody waits
+  struct Job *next;        // Injection queue, continuation list or remote free list link
+};
+
+typedef struct Job Job;
+
+// Chase-Lev work-stealing deque. The owning worker pushes and pops at the bottom (LIFO, warm
+// cache); any other thread steals from the top (FIFO, the oldest and usually largest work).
+// Fixed capacity: a full deque makes the submitter run the job itself.
+typedef struct JobDeque {
+  volatile size_t top;
+  char pad0[JOBS_CACHE_LINE - sizeof(size_t)];
+  volatile size_t bottom;
+  char pad1[JOBS_CACHE_LINE - sizeof(size_t)];
+  volatile size_t slots[JOBS_DEQUE_CAPACITY]; // Job pointers
+} JobDeque;
+
+void JobDeque_Init(JobDeque *deque);
+
+// Owner only
+bool JobDeque_Push(JobDeque *deque, Job *job);
+Job *JobDeque_Pop(JobDeque *deque);
+
+// Any thread. NULL when empty or when another thief won the race for the top job.
+Job *JobDeque_Steal(JobDeque *deque);
+
+#endif // JOBS_INTERNAL_H
@@ -19,6 +19,10 @@ bool Game_Initialize(void **state, PlatformAPI *platformAPI, EngineAPI *engineAP
 void Game_Update(void *state, float deltaTime);
 void Game_Render(void *state);
 void Game_Shutdown(void **state);
+Arena *Game_GetStateArena(void *state);
+bool Game_MigrateState(void *newState, const void *oldState, uint32_t oldVersion);
+void *Game_Snapshot(const void *state, Arena *frameArena);
+void Game_RenderSnapshot(const void *renderData);
 // End PluginAPI
 
 #ifdef __cplusplus
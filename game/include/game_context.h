@@ -4,6 +4,7 @@
 #ifndef GAME_CONTEXT_H
 #define GAME_CONTEXT_H
 
+#include "game_state.h"
 #include "plugin_api.h"
 #include "plugin_macros.h"
 
@@ -11,17 +12,28 @@
 extern "C" {
 #endif
 
+// Declared ahead of its definition so the accessors (and the extension resolver
+// the definition points at) can be defined in between
+static PluginAPI g_game_plugin;
+
+DEFINE_PLUGIN_API_ACCESSORS(g_game_plugin);
+
 static PluginAPI g_game_plugin = {
     .version = 1,
     .name = "Flight Game",
     .init = Game_Initialize,
     .update = Game_Update,
     .render = Game_Render,
-    .shutdown = Game_Shutdown
+    .shutdown = Game_Shutdown,
+    .resolve_extensions = __plugin_resolve_extensions,
+    .state_version = GAME_STATE_VERSION,
+    .state_size = sizeof(GameState),
+    .get_state_arena = Game_GetStateArena,
+    .migrate_state = Game_MigrateState,
+    .snapshot = Game_Snapshot,
+    .render_snapshot = Game_RenderSnapshot
 };
 
-DEFINE_PLUGIN_API_ACCESSORS(g_game_plugin);
-
 #ifdef __cplusplus
 }
 #endif
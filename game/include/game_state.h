@@ -16,6 +16,11 @@ typedef struct PlatformWindow PlatformWindow;
 typedef struct PlatformRenderer PlatformRenderer;
 typedef struct Arena Arena;
 
+// Bump whenever GameState's layout changes, and teach Game_MigrateState to read the old one
+// (keep the old layout around as GameStateV<n>). Hot reload then carries the running game over
+// instead of restarting it.
+#define GAME_STATE_VERSION 1
+
 typedef struct GameState {
   Arena* arena;           // Game's persistent arena
   Arena* frame_arena;     // Reset every frame
@@ -23,17 +28,23 @@ typedef struct GameState {
   PlatformWindow *window;
   PlatformRenderer *renderer;
 
-  // FPS variables
+  // Tick rate logging (Game_Update runs once per fixed simulation tick, not once per frame)
   uint32_t numUpdates;
   float accumulatedSeconds;
-  float fps;
-  float fpsUpdateFrequency;
-  bool enableFPS;
+  float tickRate;
+  float tickRateLogFrequency;
+  bool enableTickRateLog;
 
   // True if this should be updating right now
   bool isRunning;
 } GameState;
 
+// What Game_RenderSnapshot draws from: copied out of GameState into the engine's frame arena
+// so render never reads state the simulation is changing
+typedef struct GameRenderData {
+  PlatformRenderer *renderer;
+} GameRenderData;
+
 #ifdef __cplusplus
 }
 #endif
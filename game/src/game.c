@@ -77,11 +77,11 @@ bool Game_Initialize(void **state, PlatformAPI *platformAPI, EngineAPI *engineAP
   gameState->frame_arena = ARENA_CREATE_STACK(game_arena, MEGABYTES(4), DEFAULT_ALIGNMENT);
   ARENA_SET_DEBUG_NAME(gameState->frame_arena, "Game::Frame");
 
-  // FPS tracking
-  gameState->enableFPS = true;
-  gameState->fps = 0.0f;
+  // Tick rate tracking
+  gameState->enableTickRateLog = true;
+  gameState->tickRate = 0.0f;
   gameState->accumulatedSeconds = 0.0f;
-  gameState->fpsUpdateFrequency = 2.0f;
+  gameState->tickRateLogFrequency = 2.0f;
   gameState->numUpdates = 0;
 
   PLATFORM_LOG("Game initialized with arena system");
@@ -107,14 +107,14 @@ void Game_Update(void *state, const float deltaTime) {
     tested = true;
   }
 
-  // FPS tracking
+  // Tick rate tracking
   gameState->accumulatedSeconds += deltaTime;
   ++gameState->numUpdates;
 
-  if (gameState->accumulatedSeconds > gameState->fpsUpdateFrequency) {
-    gameState->fps = (float)gameState->numUpdates / gameState->accumulatedSeconds;
+  if (gameState->accumulatedSeconds > gameState->tickRateLogFrequency) {
+    gameState->tickRate = (float)gameState->numUpdates / gameState->accumulatedSeconds;
 
-    PLATFORM_LOG("Game fps: (%.2f), dt: (%.6f), # updates: (%llu), elapsed time since last print: (%.6f seconds)", gameState->fps, deltaTime, gameState->numUpdates, gameState->accumulatedSeconds);
+    PLATFORM_LOG("Game tick rate: (%.2f Hz), dt: (%.6f), # updates: (%u), elapsed time since last print: (%.6f seconds)", gameState->tickRate, deltaTime, gameState->numUpdates, gameState->accumulatedSeconds);
     PLATFORM_LOG("  Game arena used: %zu / %zu bytes (%.1f%%)",
                  ARENA_GET_USED(gameState->arena),
                  ARENA_GET_CAPACITY(gameState->arena),
@@ -134,6 +134,25 @@ void Game_Render(void *state) {
   PLATFORM_RENDERER_PRESENT(gameState->renderer);
 }
 
+void *Game_Snapshot(const void *state, Arena *frameArena) {
+  const GameState *gameState = (const GameState *)state;
+  GameRenderData *renderData = ARENA_ALLOC_ALIGNED(frameArena, sizeof(GameRenderData), DEFAULT_ALIGNMENT);
+  if (!gameState || !renderData)
+    return NULL;
+
+  renderData->renderer = gameState->renderer;
+  return renderData;
+}
+
+void Game_RenderSnapshot(const void *renderData) {
+  const GameRenderData *data = (const GameRenderData *)renderData;
+  if (!data)
+    return;
+
+  PLATFORM_RENDERER_CLEAR(data->renderer);
+  PLATFORM_RENDERER_PRESENT(data->renderer);
+}
+
 void Game_Shutdown(void **state) {
   GameState *gameState = (GameState *)(*state);
 
@@ -161,6 +180,22 @@ void Game_Shutdown(void **state) {
   }
 }
 
+Arena *Game_GetStateArena(void *state) {
+  const GameState *gameState = (const GameState *)state;
+  return gameState ? gameState->arena : NULL;
+}
+
+// Called on hot reload when GAME_STATE_VERSION changed. newState is zeroed and sized for the
+// current GameState; oldState is laid out as oldVersion. Returning false restarts the game.
+bool Game_MigrateState(void *newState, const void *oldState, uint32_t oldVersion) {
+  (void)newState;
+  (void)oldState;
+
+  // GameState has had one layout so far, so there is no older version to migrate from
+  PLATFORM_LOG_WARNING("Game_MigrateState: no migration from state v%u to v%u", oldVersion, GAME_STATE_VERSION);
+  return false;
+}
+
 PLUGIN_EXPORT PluginAPI *GetPluginAPI(void) {
   return &g_game_plugin;
 }
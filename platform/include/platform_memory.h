@@ -16,11 +16,23 @@ typedef struct PlatformMemoryStats {
   size_t allocation_granularity; // Allocation granularity (64KB on Windows)
   size_t total_physical;         // Total physical RAM
   size_t available_physical;     // Available physical RAM
+  size_t huge_page_size;         // Huge page size (typically 2MB), 0 if unsupported
+  size_t huge_page_bytes;        // This process's memory currently backed by huge pages
 } PlatformMemoryStats;
 
 // Reserve virtual address space (doesn't consume physical memory)
 void *Platform_MemoryReserve(size_t size);
 
+// Reserve address space backed by explicit huge pages (size must be a multiple of
+// huge_page_size). Returns NULL if unsupported or the huge page pool is unavailable.
+void *Platform_MemoryReserveHuge(size_t size);
+
+// Ask the OS to back a range with transparent huge pages. Returns false if unsupported.
+bool Platform_MemoryAdviseHugePages(void *ptr, size_t size);
+
+// Fault in a committed range now, so first touch during gameplay doesn't page-fault
+void Platform_MemoryPrefault(void *ptr, size_t size);
+
 // Commit physical memory to reserved region
 bool Platform_MemoryCommit(void *ptr, size_t size);
 
@@ -30,7 +42,8 @@ void Platform_MemoryDecommit(void *ptr, size_t size);
 // Release entire reservation
 void Platform_MemoryRelease(void *ptr, size_t size);
 
-// Query system memory info
+// Query system memory info. Cheap enough to poll every frame: the values that come from files
+// (huge page usage on Linux) are cached and refreshed at most once a second.
 PlatformMemoryStats Platform_MemoryGetStats(void);
 
 #ifdef __cplusplus
@@ -2,11 +2,22 @@
 // All rights reserved.
 
 #include "arena.h"
+#include "arena_trace.h"
 #include "platform.h"
+#include "platform_atomic.h"
 #include "platform_memory.h"
 #include <stdint.h>
 #include <string.h>
 
+#if defined(_MSC_VER)
+#define ARENA_THREAD_LOCAL __declspec(thread)
+#else
+#define ARENA_THREAD_LOCAL _Thread_local
+#endif
+
+// Thread scratch arenas commit their reservation in chunks of this size
+#define SCRATCH_COMMIT_CHUNK KILOBYTES(64)
+
 // ============================================================================
 // Internal Helpers
 // ============================================================================
@@ -55,25 +66,50 @@ static void unlink_child_from_parent(Arena *child) {
 // ============================================================================
 // Virtual Arena (Root Only)
 // ============================================================================
-Arena *Arena_CreateVirtual(size_t reserve_size, size_t commit_size) {
+Arena *Arena_CreateVirtual(size_t reserve_size, size_t commit_size, uint32_t flags) {
   PlatformMemoryStats stats = Platform_MemoryGetStats();
 
-  // Round reserve size to allocation granularity
-  reserve_size = align_size(reserve_size, stats.allocation_granularity);
-
   // Commit size defaults to one granularity chunk if not specified
   if (commit_size == 0) {
     commit_size = stats.allocation_granularity;
   }
-  commit_size = align_size(commit_size, stats.page_size);
 
-  // Reserve virtual address space
-  void *base = Platform_MemoryReserve(reserve_size);
+  // Explicit huge pages: the mapping's page size becomes the huge page size, so
+  // every commit/decommit range must be huge-page aligned. Fall back to THP if
+  // the huge page pool isn't available.
+  void *base = NULL;
+  size_t page_size = stats.page_size;
+  if ((flags & ARENA_VIRTUAL_HUGE_PAGES_EXPLICIT) && stats.huge_page_size) {
+    size_t huge_reserve = align_size(reserve_size, stats.huge_page_size);
+    base = Platform_MemoryReserveHuge(huge_reserve);
+    if (base) {
+      page_size = stats.huge_page_size;
+      reserve_size = huge_reserve;
+    } else {
+      flags = (flags & ~(uint32_t)ARENA_VIRTUAL_HUGE_PAGES_EXPLICIT) | ARENA_VIRTUAL_HUGE_PAGES;
+    }
+  } else {
+    flags &= ~(uint32_t)ARENA_VIRTUAL_HUGE_PAGES_EXPLICIT;
+  }
+
   if (!base) {
-    Platform_LogError("Failed to reserve %zu bytes for virtual arena", reserve_size);
-    return NULL;
+    // Round reserve size to allocation granularity
+    reserve_size = align_size(reserve_size, stats.allocation_granularity);
+
+    // Reserve virtual address space
+    base = Platform_MemoryReserve(reserve_size);
+    if (!base) {
+      Platform_LogError("Failed to reserve %zu bytes for virtual arena", reserve_size);
+      return NULL;
+    }
+
+    if ((flags & ARENA_VIRTUAL_HUGE_PAGES) && !Platform_MemoryAdviseHugePages(base, reserve_size)) {
+      flags &= ~(uint32_t)ARENA_VIRTUAL_HUGE_PAGES;
+    }
   }
 
+  commit_size = align_size(commit_size, page_size);
+
   // Commit initial memory
   if (!Platform_MemoryCommit(base, commit_size)) {
     Platform_LogError("Failed to commit %zu bytes for virtual arena", commit_size);
@@ -81,6 +117,11 @@ Arena *Arena_CreateVirtual(size_t reserve_size, size_t commit_size) {
     return NULL;
   }
 
+  // Take the page faults for the startup commit now instead of mid-frame
+  if (flags & ARENA_VIRTUAL_PREFAULT) {
+    Platform_MemoryPrefault(base, commit_size);
+  }
+
   // Place Arena struct at the beginning of committed memory
   Arena *arena = (Arena *)base;
   memset(arena, 0, sizeof(Arena));
@@ -99,16 +140,76 @@ Arena *Arena_CreateVirtual(size_t reserve_size, size_t commit_size) {
   // Virtual arena specific data
   arena->data.virtual_mem.reserve_size = reserve_size;
   arena->data.virtual_mem.commit_size = commit_size - sizeof(Arena);
-  arena->data.virtual_mem.page_size = stats.page_size;
-  arena->data.virtual_mem.commit_granularity = stats.allocation_granularity;
-
-  Platform_Log("Virtual arena created: %zu MB reserved, %zu KB committed",
+  arena->data.virtual_mem.page_size = page_size;
+  arena->data.virtual_mem.min_commit_size = commit_size - sizeof(Arena);
+  arena->data.virtual_mem.commit_count = 1;
+  arena->data.virtual_mem.decommit_count = 0;
+  arena->data.virtual_mem.flags = flags;
+  Arena_SetCommitPolicy(arena, ARENA_VIRTUAL_COMMIT_GRANULARITY, ARENA_VIRTUAL_DECOMMIT_THRESHOLD);
+
+  Platform_Log("Virtual arena created: %zu MB reserved, %zu KB committed%s%s%s",
                reserve_size / (1024 * 1024),
-               commit_size / 1024);
+               commit_size / 1024,
+               (flags & ARENA_VIRTUAL_HUGE_PAGES_EXPLICIT) ? ", explicit huge pages" : "",
+               (flags & ARENA_VIRTUAL_HUGE_PAGES) ? ", transparent huge pages" : "",
+               (flags & ARENA_VIRTUAL_PREFAULT) ? ", pre-faulted" : "");
 
   return arena;
 }
 
+void Arena_SetCommitPolicy(Arena *arena, size_t commit_granularity, size_t decommit_threshold) {
+  if (!arena || arena->type != ARENA_TYPE_VIRTUAL) {
+    Platform_LogError("Arena_SetCommitPolicy only valid for ARENA_TYPE_VIRTUAL");
+    return;
+  }
+
+  // Commit/decommit ranges must stay page-aligned
+  size_t page_size = arena->data.virtual_mem.page_size;
+  if (commit_granularity < page_size) {
+    commit_granularity = page_size;
+  }
+  arena->data.virtual_mem.commit_granularity = align_size(commit_granularity, page_size);
+  arena->data.virtual_mem.decommit_threshold = decommit_threshold;
+}
+
+// Return committed pages above the high-water mark once usage has dropped far enough
+static void virtual_maybe_decommit(Arena *arena) {
+  VirtualArenaData *vm = &arena->data.virtual_mem;
+  if (vm->decommit_threshold == 0 || vm->commit_size - arena->used < vm->decommit_threshold)
+    return;
+
+  // Offsets are relative to base, which sits sizeof(Arena) past the page-aligned
+  // reservation start; round in reservation space so the range stays page-aligned.
+  // Keep one granularity chunk of slack so we don't thrash at the boundary.
+  size_t keep = align_size(sizeof(Arena) + arena->used, vm->commit_granularity) + vm->commit_granularity - sizeof(Arena);
+  if (keep < vm->min_commit_size) {
+    keep = vm->min_commit_size;
+  }
+  if (keep >= vm->commit_size)
+    return;
+
+  size_t to_decommit = vm->commit_size - keep;
+  Platform_MemoryDecommit((char *)arena->base + keep, to_decommit);
+  vm->commit_size = keep;
+  vm->decommit_count++;
+
+  Platform_Log("Virtual arena shrank: decommitted %zu KB (%zu KB still committed)",
+               to_decommit / 1024, keep / 1024);
+}
+
+// Bytes a child arena took from its parent (matches the Create* allocations)
+static size_t arena_footprint(const Arena *arena) {
+  size_t footprint = sizeof(Arena) + arena->size + arena->alignment;
+  if (arena->type == ARENA_TYPE_MULTI_POOL) {
+    footprint = sizeof(Arena);
+    for (size_t i = 0; i < ARENA_MULTI_POOL_CLASS_COUNT; ++i) {
+      const Arena *pool = arena->data.multi_pool.pools[i];
+      footprint += sizeof(Arena) + pool->size + pool->alignment;
+    }
+  }
+  return footprint;
+}
+
 // ============================================================================
 // Bump Arena (Linear Allocator)
 // ============================================================================
@@ -151,6 +252,54 @@ Arena *Arena_CreateBump(Arena *parent, size_t size, size_t alignment) {
   return arena;
 }
 
+// ============================================================================
+// Concurrent Bump Arena (Lock-free linear allocator)
+// ============================================================================
+Arena *Arena_CreateConcurrentBump(Arena *parent, size_t size, size_t alignment) {
+  if (!parent) {
+    Platform_LogError("Concurrent bump arena requires a parent. Use Platform_GetRootArena()");
+    return NULL;
+  }
+
+  // Allocate space for Arena struct + user data + alignment padding
+  size_t total_size = sizeof(Arena) + size + alignment;
+  void *raw_mem = Arena_Alloc(parent, total_size);
+  if (!raw_mem) {
+    Platform_LogError("Failed to allocate %zu bytes from parent for concurrent bump arena", total_size);
+    return NULL;
+  }
+
+  // Arena struct at the beginning
+  Arena *arena = (Arena *)raw_mem;
+  memset(arena, 0, sizeof(Arena));
+
+  // Align base pointer after Arena struct
+  void *user_base = (char *)raw_mem + sizeof(Arena);
+  void *aligned_base = align_pointer(user_base, alignment);
+
+  arena->type = ARENA_TYPE_CONCURRENT_BUMP;
+  arena->base = aligned_base;
+  arena->raw_base = raw_mem;
+  arena->size = size;
+  arena->used = 0;
+  arena->peak_used = 0;
+  arena->alignment = alignment;
+
+  // Link to parent
+  link_child_to_parent(arena, parent);
+
+  // Concurrent-bump-specific data
+  arena->data.concurrent_bump.offset = 0;
+
+  return arena;
+}
+
+// Offset is only ever advanced, so it can run past the end once the arena is full
+static size_t concurrent_bump_used(const Arena *arena) {
+  size_t offset = Platform_AtomicLoadSize(&arena->data.concurrent_bump.offset);
+  return offset < arena->size ? offset : arena->size;
+}
+
 // ============================================================================
 // Stack Arena (Push/Pop with markers)
 // ============================================================================
@@ -195,29 +344,443 @@ Arena *Arena_CreateStack(Arena *parent, size_t size, size_t alignment) {
 }
 
 // ============================================================================
-// Block Arena (TODO: Implement)
+// Block Arena (Fixed-size pool with intrusive free-list)
 // ============================================================================
+
+// Free blocks store the next pointer in their first bytes, so every block
+// must be able to hold (and be aligned for) a pointer. Block size is padded
+// to the alignment so every block in the pool is aligned.
+static void block_normalize(size_t *block_size, size_t *alignment) {
+  if (*alignment < sizeof(void *)) {
+    *alignment = sizeof(void *);
+  }
+  if (*block_size < sizeof(void *)) {
+    *block_size = sizeof(void *);
+  }
+  *block_size = align_size(*block_size, *alignment);
+}
+
+// Bytes needed for an Arena struct + blocks + alignment padding
+static size_t block_footprint(size_t block_size, size_t block_count, size_t alignment) {
+  return sizeof(Arena) + block_size * block_count + alignment;
+}
+
+// Lay out a block arena in raw_mem (sized by block_footprint). Expects normalized sizes.
+static Arena *block_init(void *raw_mem, Arena *parent, size_t block_size, size_t block_count, size_t alignment) {
+  // Arena struct at the beginning
+  Arena *arena = (Arena *)raw_mem;
+  memset(arena, 0, sizeof(Arena));
+
+  // Align base pointer after Arena struct
+  void *user_base = (char *)raw_mem + sizeof(Arena);
+  void *aligned_base = align_pointer(user_base, alignment);
+
+  arena->type = ARENA_TYPE_BLOCK;
+  arena->base = aligned_base;
+  arena->raw_base = raw_mem;
+  arena->size = block_size * block_count;
+  arena->used = 0;
+  arena->peak_used = 0;
+  arena->alignment = alignment;
+
+  // Link to parent
+  link_child_to_parent(arena, parent);
+
+  // Block-specific data. Blocks are carved lazily from the base on first use,
+  // so creating a large pool doesn't touch (or fault in) every page up front.
+  arena->data.block.block_size = block_size;
+  arena->data.block.block_count = block_count;
+  arena->data.block.free_list = NULL;
+  arena->data.block.free_count = block_count;
+  arena->data.block.carved_count = 0;
+
+  return arena;
+}
+
 Arena *Arena_CreateBlock(Arena *parent, size_t block_size, size_t block_count, size_t alignment) {
-  Platform_LogError("Arena_CreateBlock not yet implemented");
-  return NULL;
+  if (!parent) {
+    Platform_LogError("Block arena requires a parent. Use Platform_GetRootArena()");
+    return NULL;
+  }
+
+  if (block_size == 0 || block_count == 0) {
+    Platform_LogError("Block arena requires a non-zero block size and count");
+    return NULL;
+  }
+
+  // Passing CACHE_LINE_SIZE as the alignment gives each block its own cache line(s).
+  block_normalize(&block_size, &alignment);
+
+  size_t total_size = block_footprint(block_size, block_count, alignment);
+  void *raw_mem = Arena_Alloc(parent, total_size);
+  if (!raw_mem) {
+    Platform_LogError("Failed to allocate %zu bytes from parent for block arena", total_size);
+    return NULL;
+  }
+
+  return block_init(raw_mem, parent, block_size, block_count, alignment);
 }
 
 // ============================================================================
-// Multi-Pool Arena (TODO: Implement)
+// Multi-Pool Arena (Power-of-2 size classes backed by block arenas)
 // ============================================================================
-Arena *Arena_CreateMultiPool(Arena *parent, size_t total_size) {
-  Platform_LogError("Arena_CreateMultiPool not yet implemented");
+static const size_t g_multi_pool_classes[ARENA_MULTI_POOL_CLASS_COUNT] = {
+    16, 32, 64, 128, 256, 512, 1024, 2048};
+
+static const char *g_multi_pool_names[ARENA_MULTI_POOL_CLASS_COUNT] = {
+    "MultiPool::16", "MultiPool::32", "MultiPool::64", "MultiPool::128",
+    "MultiPool::256", "MultiPool::512", "MultiPool::1024", "MultiPool::2048"};
+
+// Size class for a request: 1..16 -> 0, 17..32 -> 1, ... 1025..2048 -> 7.
+// Anything larger returns ARENA_MULTI_POOL_CLASS_COUNT or more.
+static size_t multi_pool_class_index(size_t size) {
+  if (size <= 16)
+    return 0;
+
+  size_t bits = (size - 1) >> 4;
+#if defined(__GNUC__) || defined(__clang__)
+  return (size_t)(sizeof(unsigned long long) * 8) - (size_t)__builtin_clzll((unsigned long long)bits);
+#else
+  size_t index = 0;
+  while (bits) {
+    bits >>= 1;
+    index++;
+  }
+  return index;
+#endif
+}
+
+// A multi-pool's own used counts its class blocks; bytes it had the parent serve come on top
+static size_t arena_used(const Arena *arena) {
+  if (arena->type == ARENA_TYPE_MULTI_POOL) {
+    return arena->used + arena->data.multi_pool.fallback_used;
+  }
+  return arena->used;
+}
+
+static void arena_fold_peak(Arena *arena) {
+  size_t used = arena_used(arena);
+  if (used > arena->peak_used) {
+    arena->peak_used = used;
+  }
+  if (arena->type == ARENA_TYPE_STACK && arena->data.stack.offset > arena->data.stack.peak_used) {
+    arena->data.stack.peak_used = arena->data.stack.offset;
+  }
+}
+
+// Internal entry points taking the call site to record, so nested calls (a pool inside a
+// multi-pool, Realloc's alloc/free) are attributed to the caller of the public function
+static void *arena_alloc_aligned_at(Arena *arena, size_t size, size_t alignment, const void *call_site);
+static void arena_free_at(Arena *arena, void *ptr, const void *call_site);
+static bool arena_try_extend_at(Arena *arena, void *ptr, size_t old_size, size_t new_size, const void *call_site);
+
+// Allocations the size classes can't serve come from the parent with an ArenaFallbackBlock in
+// front, so Free and Reset can find them again. A freed block goes back to the parent when it can
+// take it (a Block/Multi-pool parent, or the top of a linear one) and is otherwise kept for reuse,
+// so a steady alloc/free pattern of large sizes stops growing the parent.
+static size_t multi_pool_fallback_header(size_t alignment) {
+  return align_size(sizeof(ArenaFallbackBlock), alignment);
+}
+
+static void *multi_pool_fallback_alloc(Arena *arena, size_t size, size_t alignment, const void *call_site) {
+  MultiPoolArenaData *multi = &arena->data.multi_pool;
+
+  // Smallest freed block that fits and is aligned well enough
+  ArenaFallbackBlock **best = NULL;
+  for (ArenaFallbackBlock **link = &multi->fallback_free; *link; link = &(*link)->next) {
+    const ArenaFallbackBlock *candidate = *link;
+    if (candidate->capacity >= size && ((uintptr_t)candidate->payload & (alignment - 1)) == 0 &&
+        (!best || candidate->capacity < (*best)->capacity)) {
+      best = link;
+    }
+  }
+
+  ArenaFallbackBlock *block;
+  if (best) {
+    block = *best;
+    *best = block->next;
+    multi->fallback_cached -= block->capacity;
+  } else {
+    const size_t raw_alignment = alignment > _Alignof(ArenaFallbackBlock) ? alignment : _Alignof(ArenaFallbackBlock);
+    const size_t header = multi_pool_fallback_header(raw_alignment);
+    const char *parent_top = (const char *)arena->parent->base + Arena_GetUsed(arena->parent);
+    block = arena_alloc_aligned_at(arena->parent, header + size, raw_alignment, call_site);
+    if (!block)
+      return NULL;
+    block->payload = (char *)block + header;
+    block->capacity = size;
+    block->lead = (const char *)block >= parent_top && (size_t)((const char *)block - parent_top) < raw_alignment
+                    ? (size_t)((const char *)block - parent_top)
+                    : 0;
+  }
+
+  block->size = size;
+  block->next = multi->fallback_live;
+  multi->fallback_live = block;
+  multi->fallback_used += size;
+  return block->payload;
+}
+
+static ArenaFallbackBlock **multi_pool_fallback_find(MultiPoolArenaData *multi, const void *ptr) {
+  for (ArenaFallbackBlock **link = &multi->fallback_live; *link; link = &(*link)->next) {
+    if ((*link)->payload == ptr)
+      return link;
+  }
   return NULL;
 }
 
+// Hand a block back to the parent if it can take it now
+static bool multi_pool_fallback_release(Arena *arena, ArenaFallbackBlock *block, const void *call_site) {
+  Arena *parent = arena->parent;
+  if (parent->type == ARENA_TYPE_BLOCK || parent->type == ARENA_TYPE_MULTI_POOL) {
+    arena_free_at(parent, block, call_site);
+    return true;
+  }
+
+  const size_t total = block->lead + (size_t)((char *)block->payload - (char *)block) + block->capacity;
+  switch (parent->type) {
+    case ARENA_TYPE_BUMP:
+    case ARENA_TYPE_STACK:
+    case ARENA_TYPE_VIRTUAL:
+    case ARENA_TYPE_SCRATCH:
+      return arena_try_extend_at(parent, (char *)block - block->lead, total, 0, call_site);
+    default:
+      return false;
+  }
+}
+
+static void multi_pool_fallback_cache(Arena *arena, ArenaFallbackBlock *block, const void *call_site) {
+  MultiPoolArenaData *multi = &arena->data.multi_pool;
+  if (!multi_pool_fallback_release(arena, block, call_site)) {
+    block->next = multi->fallback_free;
+    multi->fallback_free = block;
+    multi->fallback_cached += block->capacity;
+  }
+}
+
+// Reset/Destroy: every live block becomes free, then as many cached blocks as the parent will
+// take go back (repeatedly, since releasing the top of a linear parent exposes the next one)
+static void multi_pool_fallback_release_all(Arena *arena, const void *call_site) {
+  MultiPoolArenaData *multi = &arena->data.multi_pool;
+  while (multi->fallback_live) {
+    ArenaFallbackBlock *block = multi->fallback_live;
+    multi->fallback_live = block->next;
+    multi_pool_fallback_cache(arena, block, call_site);
+  }
+  multi->fallback_used = 0;
+
+  bool released = true;
+  while (released) {
+    released = false;
+    for (ArenaFallbackBlock **link = &multi->fallback_free; *link;) {
+      ArenaFallbackBlock *block = *link;
+      if (multi_pool_fallback_release(arena, block, call_site)) {
+        *link = block->next;
+        multi->fallback_cached -= block->capacity;
+        released = true;
+      } else {
+        link = &block->next;
+      }
+    }
+  }
+}
+
+Arena *Arena_CreateMultiPool(Arena *parent, size_t total_size) {
+  if (!parent) {
+    Platform_LogError("Multi-pool arena requires a parent. Use Platform_GetRootArena()");
+    return NULL;
+  }
+
+  // Split the budget evenly (in bytes) across the size classes, so small
+  // classes get many blocks and large classes get few.
+  size_t class_budget = total_size / ARENA_MULTI_POOL_CLASS_COUNT;
+  size_t counts[ARENA_MULTI_POOL_CLASS_COUNT];
+  size_t pools_size = 0;
+  size_t footprint = sizeof(Arena);
+
+  for (size_t i = 0; i < ARENA_MULTI_POOL_CLASS_COUNT; ++i) {
+    size_t class_size = g_multi_pool_classes[i];
+    counts[i] = class_budget / class_size;
+    if (counts[i] == 0) {
+      counts[i] = 1;
+    }
+    pools_size += class_size * counts[i];
+    footprint += block_footprint(class_size, counts[i], class_size);
+  }
+
+  // One parent allocation holds the multi-pool header and every child pool
+  void *raw_mem = Arena_Alloc(parent, footprint);
+  if (!raw_mem) {
+    Platform_LogError("Failed to allocate %zu bytes from parent for multi-pool arena", footprint);
+    return NULL;
+  }
+
+  // Arena struct at the beginning
+  Arena *arena = (Arena *)raw_mem;
+  memset(arena, 0, sizeof(Arena));
+
+  arena->type = ARENA_TYPE_MULTI_POOL;
+  arena->base = (char *)raw_mem + sizeof(Arena);
+  arena->raw_base = raw_mem;
+  arena->size = pools_size;
+  arena->used = 0;
+  arena->peak_used = 0;
+  arena->alignment = DEFAULT_ALIGNMENT;
+
+  // Link to parent
+  link_child_to_parent(arena, parent);
+
+  // Carve each size-class pool out of our region. Blocks are aligned to their
+  // class size, so a request's alignment is satisfied by routing on max(size, alignment).
+  char *cursor = (char *)arena->base;
+  for (size_t i = 0; i < ARENA_MULTI_POOL_CLASS_COUNT; ++i) {
+    size_t class_size = g_multi_pool_classes[i];
+    Arena *pool = block_init(cursor, arena, class_size, counts[i], class_size);
+    pool->debug_name = g_multi_pool_names[i];
+
+    arena->data.multi_pool.pools[i] = pool;
+    arena->data.multi_pool.size_classes[i] = class_size;
+    cursor += block_footprint(class_size, counts[i], class_size);
+  }
+  arena->data.multi_pool.fallback_live = NULL;
+  arena->data.multi_pool.fallback_free = NULL;
+  arena->data.multi_pool.fallback_used = 0;
+  arena->data.multi_pool.fallback_cached = 0;
+
+  return arena;
+}
+
 // ============================================================================
-// Scratch Arena (TODO: Implement)
+// Scratch Arena (Temporary scoped, single-thread)
 // ============================================================================
 Arena *Arena_CreateScratch(Arena *parent, size_t size, size_t alignment) {
-  Platform_LogError("Arena_CreateScratch not yet implemented");
+  if (!parent) {
+    Platform_LogError("Scratch arena requires a parent. Use Platform_GetRootArena() or Arena_GetThreadScratch()");
+    return NULL;
+  }
+
+  // Allocate space for Arena struct + user data + alignment padding
+  size_t total_size = sizeof(Arena) + size + alignment;
+  void *raw_mem = Arena_Alloc(parent, total_size);
+  if (!raw_mem) {
+    Platform_LogError("Failed to allocate %zu bytes from parent for scratch arena", total_size);
+    return NULL;
+  }
+
+  // Arena struct at the beginning
+  Arena *arena = (Arena *)raw_mem;
+  memset(arena, 0, sizeof(Arena));
+
+  // Align base pointer after Arena struct
+  void *user_base = (char *)raw_mem + sizeof(Arena);
+  void *aligned_base = align_pointer(user_base, alignment);
+
+  arena->type = ARENA_TYPE_SCRATCH;
+  arena->base = aligned_base;
+  arena->raw_base = raw_mem;
+  arena->size = size;
+  arena->used = 0;
+  arena->peak_used = 0;
+  arena->alignment = alignment;
+
+  // Link to parent
+  link_child_to_parent(arena, parent);
+
+  // Scratch-specific data (parent-backed: fully committed, commit_size unused)
+  arena->data.scratch.offset = 0;
+  arena->data.scratch.commit_size = 0;
+  arena->data.scratch.thread_id = Platform_GetThreadID();
+  arena->data.scratch.temp_depth = 0;
+  arena->data.scratch.auto_reset = true;
+
+  return arena;
+}
+
+// ============================================================================
+// Per-Thread Scratch Arenas
+// ============================================================================
+static ARENA_THREAD_LOCAL Arena *t_thread_scratch[ARENA_THREAD_SCRATCH_COUNT];
+
+// Standalone scratch arena that owns its own reservation (no parent), so
+// threads never touch the root arena (or each other) to get scratch memory.
+static Arena *scratch_create_reserved(size_t reserve_size) {
+  PlatformMemoryStats stats = Platform_MemoryGetStats();
+
+  reserve_size = align_size(reserve_size, stats.allocation_granularity);
+  size_t commit_size = align_size(sizeof(Arena) + SCRATCH_COMMIT_CHUNK, stats.page_size);
+
+  void *base = Platform_MemoryReserve(reserve_size);
+  if (!base) {
+    Platform_LogError("Failed to reserve %zu bytes for thread scratch arena", reserve_size);
+    return NULL;
+  }
+
+  if (!Platform_MemoryCommit(base, commit_size)) {
+    Platform_LogError("Failed to commit %zu bytes for thread scratch arena", commit_size);
+    Platform_MemoryRelease(base, reserve_size);
+    return NULL;
+  }
+
+  // Place Arena struct at the beginning of committed memory
+  Arena *arena = (Arena *)base;
+  memset(arena, 0, sizeof(Arena));
+
+  arena->type = ARENA_TYPE_SCRATCH;
+  arena->base = (char *)base + sizeof(Arena);
+  arena->raw_base = base;
+  arena->size = reserve_size - sizeof(Arena);
+  arena->alignment = DEFAULT_ALIGNMENT;
+  arena->debug_name = "Thread Scratch";
+
+  arena->data.scratch.offset = 0;
+  arena->data.scratch.commit_size = commit_size - sizeof(Arena);
+  arena->data.scratch.thread_id = Platform_GetThreadID();
+  arena->data.scratch.temp_depth = 0;
+  arena->data.scratch.auto_reset = true;
+
+  return arena;
+}
+
+Arena *Arena_GetThreadScratch(Arena **conflicts, size_t conflict_count) {
+  for (size_t i = 0; i < ARENA_THREAD_SCRATCH_COUNT; ++i) {
+    Arena *scratch = t_thread_scratch[i];
+
+    // Created on first use, so threads that never need a second scratch never reserve one
+    if (!scratch) {
+      scratch = scratch_create_reserved(ARENA_THREAD_SCRATCH_RESERVE);
+      if (!scratch) {
+        return NULL;
+      }
+      t_thread_scratch[i] = scratch;
+    }
+
+    bool conflicted = false;
+    for (size_t c = 0; c < conflict_count; ++c) {
+      if (conflicts[c] == scratch) {
+        conflicted = true;
+        break;
+      }
+    }
+
+    if (!conflicted) {
+      return scratch;
+    }
+  }
+
+  Platform_LogError("Arena_GetThreadScratch: all %d thread scratch arenas are in the conflict list",
+                    ARENA_THREAD_SCRATCH_COUNT);
   return NULL;
 }
 
+void Arena_ReleaseThreadScratch(void) {
+  for (size_t i = 0; i < ARENA_THREAD_SCRATCH_COUNT; ++i) {
+    if (t_thread_scratch[i]) {
+      Arena_Destroy(t_thread_scratch[i]);
+      t_thread_scratch[i] = NULL;
+    }
+  }
+}
+
 // ============================================================================
 // Arena Destruction
 // ============================================================================
@@ -233,14 +796,34 @@ void Arena_Destroy(Arena *arena) {
     child = next;
   }
 
+  // Give parent-served allocations back before our own bytes, which sit below them
+  if (arena->type == ARENA_TYPE_MULTI_POOL) {
+    multi_pool_fallback_release_all(arena, ARENA_CALL_SITE());
+  }
+
+  // A child sitting at the top of a Virtual parent hands its bytes back
+  Arena *parent = arena->parent;
+  if (parent && parent->type == ARENA_TYPE_VIRTUAL) {
+    char *child_end = (char *)arena->raw_base + arena_footprint(arena);
+    if (child_end == (char *)parent->base + parent->used) {
+      parent->used = (size_t)((char *)arena->raw_base - (char *)parent->base);
+      virtual_maybe_decommit(parent);
+    }
+  }
+
   // Unlink from parent
   unlink_child_from_parent(arena);
 
   // Free based on type
   if (arena->type == ARENA_TYPE_VIRTUAL) {
-    // Virtual arena owns OS memory
-    Platform_MemoryRelease(arena->raw_base, arena->data.virtual_mem.reserve_size);
-    Platform_Log("Virtual arena destroyed");
+    // Virtual arena owns OS memory (and the Arena struct lives inside it)
+    VirtualArenaData vm = arena->data.virtual_mem;
+    Platform_MemoryRelease(arena->raw_base, vm.reserve_size);
+    Platform_Log("Virtual arena destroyed (%zu commits, %zu decommits)",
+                 vm.commit_count, vm.decommit_count);
+  } else if (arena->type == ARENA_TYPE_SCRATCH && arena->data.scratch.commit_size) {
+    // Thread scratch owns its reservation (parent-backed scratch leaves commit_size at 0)
+    Platform_MemoryRelease(arena->raw_base, arena->size + sizeof(Arena));
   }
   // Child arenas don't free anything - parent owns their memory
 }
@@ -248,7 +831,56 @@ void Arena_Destroy(Arena *arena) {
 // ============================================================================
 // Arena Allocation
 // ============================================================================
-void *Arena_AllocAligned(Arena *arena, size_t size, size_t alignment) {
+// Commit enough of a Virtual arena to cover new_used bytes
+static bool virtual_ensure_committed(Arena *arena, size_t new_used) {
+  VirtualArenaData *vm = &arena->data.virtual_mem;
+  if (new_used <= vm->commit_size)
+    return true;
+
+  // Commit ahead in whole chunks so steady growth costs one syscall per chunk
+  size_t needed = new_used - vm->commit_size;
+  size_t to_commit = align_size(needed, vm->commit_granularity);
+  if (to_commit > arena->size - vm->commit_size) {
+    to_commit = align_size(arena->size - vm->commit_size, vm->page_size);
+  }
+
+  void *commit_ptr = (char *)arena->base + vm->commit_size;
+  if (!Platform_MemoryCommit(commit_ptr, to_commit)) {
+    Platform_LogError("Failed to commit %zu more bytes to virtual arena", to_commit);
+    return false;
+  }
+
+  // Pre-faulting growth too batches a chunk's faults into the commit
+  if (vm->flags & ARENA_VIRTUAL_PREFAULT) {
+    Platform_MemoryPrefault(commit_ptr, to_commit);
+  }
+
+  vm->commit_size += to_commit;
+  vm->commit_count++;
+  Platform_Log("Virtual arena grew: committed %zu KB more", to_commit / 1024);
+  return true;
+}
+
+// Thread scratch arenas own their reservation and commit on demand
+static bool scratch_ensure_committed(Arena *arena, size_t new_offset) {
+  size_t commit_size = arena->data.scratch.commit_size;
+  if (!commit_size || new_offset <= commit_size)
+    return true;
+
+  size_t to_commit = align_size(new_offset - commit_size, SCRATCH_COMMIT_CHUNK);
+  if (to_commit > arena->size - commit_size) {
+    to_commit = arena->size - commit_size;
+  }
+
+  if (!Platform_MemoryCommit((char *)arena->base + commit_size, to_commit)) {
+    Platform_LogError("Failed to commit %zu more bytes to scratch arena", to_commit);
+    return false;
+  }
+  arena->data.scratch.commit_size += to_commit;
+  return true;
+}
+
+static void *arena_alloc_aligned_at(Arena *arena, size_t size, size_t alignment, const void *call_site) {
   if (!arena)
     return NULL;
   if (size == 0)
@@ -265,30 +897,18 @@ void *Arena_AllocAligned(Arena *arena, size_t size, size_t alignment) {
       size_t padding = aligned_ptr - current_ptr;
       size_t total_size = padding + size;
 
-      // Check if we need to commit more memory
       size_t new_used = arena->used + total_size;
-      if (new_used > arena->data.virtual_mem.commit_size) {
-        // Need to commit more pages
-        size_t commit_size = arena->data.virtual_mem.commit_size;
-        size_t needed = new_used - commit_size;
-        size_t to_commit = align_size(needed, arena->data.virtual_mem.page_size);
-
-        void *commit_ptr = (char *)arena->base + commit_size;
-        if (!Platform_MemoryCommit(commit_ptr, to_commit)) {
-          Platform_LogError("Failed to commit %zu more bytes to virtual arena", to_commit);
-          return NULL;
-        }
-
-        arena->data.virtual_mem.commit_size += to_commit;
-        Platform_Log("Virtual arena grew: committed %zu KB more", to_commit / 1024);
-      }
-
       if (new_used > arena->size) {
         Platform_LogError("Virtual arena out of address space (%zu / %zu bytes used)",
                           new_used, arena->size);
         return NULL;
       }
 
+      // Check if we need to commit more memory
+      if (!virtual_ensure_committed(arena, new_used)) {
+        return NULL;
+      }
+
       result = (void *)aligned_ptr;
       arena->used = new_used;
 
@@ -340,21 +960,339 @@ void *Arena_AllocAligned(Arena *arena, size_t size, size_t alignment) {
 
       break;
     }
+    case ARENA_TYPE_BLOCK: {
+      // Block arena hands out exactly one fixed-size block per request
+      BlockArenaData *block = &arena->data.block;
+      if (size > block->block_size || alignment > arena->alignment) {
+        Platform_LogError("Block arena request (%zu bytes, align %zu) exceeds block (%zu bytes, align %zu)",
+                          size, alignment, block->block_size, arena->alignment);
+        return NULL;
+      }
+
+      if (block->free_list) {
+        // Pop the most recently freed block (still warm in cache)
+        result = block->free_list;
+        block->free_list = *(void **)result;
+      } else if (block->carved_count < block->block_count) {
+        result = (char *)arena->base + block->carved_count * block->block_size;
+        block->carved_count++;
+      } else {
+        Platform_LogError("Block arena out of blocks (%zu / %zu blocks used)",
+                          block->block_count, block->block_count);
+        return NULL;
+      }
+
+      block->free_count--;
+      arena->used += block->block_size;
+
+      break;
+    }
+    case ARENA_TYPE_MULTI_POOL: {
+      // Route to the smallest class that fits; overflow into larger classes when full
+      MultiPoolArenaData *multi = &arena->data.multi_pool;
+      size_t index = multi_pool_class_index(size > alignment ? size : alignment);
+      for (; index < ARENA_MULTI_POOL_CLASS_COUNT; ++index) {
+        Arena *pool = multi->pools[index];
+        if (pool->data.block.free_count > 0) {
+          result = arena_alloc_aligned_at(pool, size, alignment, call_site);
+          arena->used += pool->data.block.block_size;
+          break;
+        }
+      }
+
+      if (!result) {
+        // Oversize (or every fitting class exhausted): the parent serves it
+        result = multi_pool_fallback_alloc(arena, size, alignment, call_site);
+        if (!result) {
+          Platform_LogError("Multi-pool arena could not satisfy %zu bytes (parent exhausted)", size);
+          return NULL;
+        }
+      }
+
+      break;
+    }
+    case ARENA_TYPE_SCRATCH: {
+#ifndef NDEBUG
+      if (arena->data.scratch.thread_id != Platform_GetThreadID()) {
+        Platform_LogError("Scratch arena '%s' used from a thread that doesn't own it",
+                          arena->debug_name ? arena->debug_name : "unnamed");
+        return NULL;
+      }
+#endif
+
+      // Scratch arena allocates just like Bump
+      size_t current_offset = arena->data.scratch.offset;
+      uintptr_t current_ptr = (uintptr_t)arena->base + current_offset;
+      uintptr_t aligned_ptr = ALIGN_UP(current_ptr, alignment);
+      size_t padding = aligned_ptr - current_ptr;
+      size_t new_offset = current_offset + padding + size;
+
+      if (new_offset > arena->size) {
+        Platform_LogError("Scratch arena out of memory (%zu / %zu bytes used)",
+                          new_offset, arena->size);
+        return NULL;
+      }
+
+      if (!scratch_ensure_committed(arena, new_offset)) {
+        return NULL;
+      }
+
+      result = (void *)aligned_ptr;
+      arena->data.scratch.offset = new_offset;
+      arena->used = new_offset;
+
+      break;
+    }
+    case ARENA_TYPE_CONCURRENT_BUMP: {
+      // Sizes are rounded to the arena alignment so every offset stays aligned and a
+      // plain fetch-add is enough. Stricter alignments over-reserve and align inside.
+      size_t base_alignment = arena->alignment;
+      size_t reserve = align_size(size, base_alignment);
+      if (alignment > base_alignment) {
+        reserve += alignment - base_alignment;
+      }
+
+      size_t offset = Platform_AtomicFetchAddSize(&arena->data.concurrent_bump.offset, reserve);
+      if (offset + reserve > arena->size) {
+        Platform_LogError("Concurrent bump arena out of memory (%zu / %zu bytes used)",
+                          offset + reserve, arena->size);
+        return NULL;
+      }
+
+      // No shared used/peak writes on the hot path: both are derived from the
+      // offset on query/reset, so concurrent callers only ever touch one atomic.
+      uintptr_t ptr = (uintptr_t)arena->base + offset;
+      result = (void *)ALIGN_UP(ptr, alignment);
+      ARENA_TRACE_AT(arena, ARENA_TRACE_ALLOC, result, size, alignment, call_site);
+      return result;
+    }
     default:
       Platform_LogError("Arena type %d not yet implemented for allocation", arena->type);
       return NULL;
   }
 
   // Update peak usage
-  if (arena->used > arena->peak_used) {
-    arena->peak_used = arena->used;
-  }
+  arena_fold_peak(arena);
 
+  ARENA_TRACE_AT(arena, ARENA_TRACE_ALLOC, result, size, alignment, call_site);
   return result;
 }
 
+// The public wrappers capture their own return address: the caller's call site
+void *Arena_AllocAligned(Arena *arena, size_t size, size_t alignment) {
+  return arena_alloc_aligned_at(arena, size, alignment, ARENA_CALL_SITE());
+}
+
 void *Arena_Alloc(Arena *arena, size_t size) {
-  return Arena_AllocAligned(arena, size, arena ? arena->alignment : DEFAULT_ALIGNMENT);
+  return arena_alloc_aligned_at(arena, size, arena ? arena->alignment : DEFAULT_ALIGNMENT, ARENA_CALL_SITE());
+}
+
+void *Arena_PushSlow(Arena *arena, ArenaType expected_type, size_t size, size_t alignment) {
+  if (!arena)
+    return NULL;
+
+  if (arena->type != expected_type) {
+    Platform_LogError("Inline push expected arena type %d but '%s' is type %d",
+                      expected_type, arena->debug_name ? arena->debug_name : "unnamed", arena->type);
+    return NULL;
+  }
+
+  // Bump/Stack arenas can't grow, so the generic path just reports the overflow. The inline
+  // pushes are always inlined into traced builds, so this is the pushing code's call site.
+  return arena_alloc_aligned_at(arena, size, alignment, ARENA_CALL_SITE());
+}
+
+// ============================================================================
+// Arena Free (individual allocations)
+// ============================================================================
+static void arena_free_at(Arena *arena, void *ptr, const void *call_site) {
+  if (!arena || !ptr)
+    return;
+
+  switch (arena->type) {
+    case ARENA_TYPE_BLOCK: {
+      BlockArenaData *block = &arena->data.block;
+
+#ifndef NDEBUG
+      // Validate the pointer is the start of a block we handed out
+      uintptr_t offset = (uintptr_t)ptr - (uintptr_t)arena->base;
+      if ((uintptr_t)ptr < (uintptr_t)arena->base ||
+          offset >= block->carved_count * block->block_size ||
+          offset % block->block_size != 0) {
+        Platform_LogError("Arena_Free: %p is not a block of arena '%s'",
+                          ptr, arena->debug_name ? arena->debug_name : "unnamed");
+        return;
+      }
+#endif
+
+      // Push onto the intrusive free list
+      *(void **)ptr = block->free_list;
+      block->free_list = ptr;
+      block->free_count++;
+      arena->used -= block->block_size;
+      ARENA_TRACE_AT(arena, ARENA_TRACE_FREE, ptr, block->block_size, arena->alignment, call_site);
+      break;
+    }
+
+    case ARENA_TYPE_MULTI_POOL: {
+      // Find the owning class pool (at most one range check per class)
+      uintptr_t addr = (uintptr_t)ptr;
+      for (size_t i = 0; i < ARENA_MULTI_POOL_CLASS_COUNT; ++i) {
+        Arena *pool = arena->data.multi_pool.pools[i];
+        uintptr_t pool_base = (uintptr_t)pool->base;
+        if (addr >= pool_base && addr < pool_base + pool->size) {
+          arena_free_at(pool, ptr, call_site);
+          arena->used -= pool->data.block.block_size;
+          ARENA_TRACE_AT(arena, ARENA_TRACE_FREE, ptr, pool->data.block.block_size, pool->alignment, call_site);
+          return;
+        }
+      }
+
+      MultiPoolArenaData *multi = &arena->data.multi_pool;
+      ArenaFallbackBlock **link = multi_pool_fallback_find(multi, ptr);
+      if (!link) {
+        Platform_LogError("Arena_Free: %p was not allocated from multi-pool arena '%s'",
+                          ptr, arena->debug_name ? arena->debug_name : "unnamed");
+        return;
+      }
+
+      ArenaFallbackBlock *block = *link;
+      *link = block->next;
+      multi->fallback_used -= block->size;
+      ARENA_TRACE_AT(arena, ARENA_TRACE_FREE, ptr, block->size, 0, call_site);
+      multi_pool_fallback_cache(arena, block, call_site);
+      break;
+    }
+
+    default:
+      Platform_LogError("Arena type %d does not support Arena_Free (use Reset/PopTo)", arena->type);
+      break;
+  }
+}
+
+void Arena_Free(Arena *arena, void *ptr) {
+  arena_free_at(arena, ptr, ARENA_CALL_SITE());
+}
+
+// Inline pushes (Arena_BumpPush/Arena_StackPush) skip peak tracking; catch up
+// before usage goes down and whenever someone asks
+// ============================================================================
+// Arena Extend / Realloc
+// ============================================================================
+static bool arena_try_extend_at(Arena *arena, void *ptr, size_t old_size, size_t new_size, const void *call_site) {
+  if (!arena || !ptr)
+    return false;
+
+  size_t *top = NULL;
+  switch (arena->type) {
+    case ARENA_TYPE_BUMP:
+      top = &arena->data.bump.offset;
+      break;
+    case ARENA_TYPE_STACK:
+      top = &arena->data.stack.offset;
+      break;
+    case ARENA_TYPE_VIRTUAL:
+      top = &arena->used;
+      break;
+    case ARENA_TYPE_SCRATCH:
+#ifndef NDEBUG
+      if (arena->data.scratch.thread_id != Platform_GetThreadID()) {
+        Platform_LogError("Scratch arena '%s' used from a thread that doesn't own it",
+                          arena->debug_name ? arena->debug_name : "unnamed");
+        return false;
+      }
+#endif
+      top = &arena->data.scratch.offset;
+      break;
+
+    case ARENA_TYPE_BLOCK:
+      // Every block is block_size bytes, whatever was asked for
+      return new_size <= arena->data.block.block_size;
+
+    case ARENA_TYPE_MULTI_POOL: {
+      uintptr_t addr = (uintptr_t)ptr;
+      for (size_t i = 0; i < ARENA_MULTI_POOL_CLASS_COUNT; ++i) {
+        Arena *pool = arena->data.multi_pool.pools[i];
+        if (addr >= (uintptr_t)pool->base && addr < (uintptr_t)pool->base + pool->size) {
+          return new_size <= pool->data.block.block_size;
+        }
+      }
+      // Parent fallback allocation: fine while it stays within the block's capacity
+      ArenaFallbackBlock **link = multi_pool_fallback_find(&arena->data.multi_pool, ptr);
+      if (!link || new_size > (*link)->capacity)
+        return false;
+      arena->data.multi_pool.fallback_used += new_size - (*link)->size;
+      (*link)->size = new_size;
+      arena_fold_peak(arena);
+      return true;
+    }
+
+    default:
+      return false;
+  }
+
+  // Only the most recent allocation can move the top
+  uintptr_t base = (uintptr_t)arena->base;
+  uintptr_t start = (uintptr_t)ptr;
+  if (start < base || start + old_size != base + *top)
+    return false;
+
+  size_t offset = start - base;
+  if (new_size > arena->size - offset)
+    return false;
+
+  size_t new_top = offset + new_size;
+  if (arena->type == ARENA_TYPE_VIRTUAL && !virtual_ensure_committed(arena, new_top))
+    return false;
+  if (arena->type == ARENA_TYPE_SCRATCH && !scratch_ensure_committed(arena, new_top))
+    return false;
+
+  *top = new_top;
+  arena->used = new_top;
+  arena_fold_peak(arena);
+  ARENA_TRACE_AT(arena, ARENA_TRACE_EXTEND, ptr, new_size, 0, call_site);
+  return true;
+}
+
+bool Arena_TryExtend(Arena *arena, void *ptr, size_t old_size, size_t new_size) {
+  return arena_try_extend_at(arena, ptr, old_size, new_size, ARENA_CALL_SITE());
+}
+
+static void *arena_realloc_at(Arena *arena, void *ptr, size_t old_size, size_t used_size, size_t new_size,
+                              size_t alignment, const void *call_site) {
+  if (!arena)
+    return NULL;
+  if (!ptr || old_size == 0)
+    return arena_alloc_aligned_at(arena, new_size, alignment, call_site);
+
+  if (arena_try_extend_at(arena, ptr, old_size, new_size, call_site))
+    return ptr;
+
+  // Shrinking something that isn't on top: keep it where it is
+  if (new_size <= old_size)
+    return ptr;
+
+  void *result = arena_alloc_aligned_at(arena, new_size, alignment, call_site);
+  if (!result)
+    return NULL;
+
+  memcpy(result, ptr, used_size < old_size ? used_size : old_size);
+
+  // Pools take the old allocation back; linear arenas reclaim it on reset/pop
+  if (arena->type == ARENA_TYPE_BLOCK || arena->type == ARENA_TYPE_MULTI_POOL) {
+    arena_free_at(arena, ptr, call_site);
+  }
+
+  return result;
+}
+
+void *Arena_Realloc(Arena *arena, void *ptr, size_t old_size, size_t new_size, size_t alignment) {
+  return arena_realloc_at(arena, ptr, old_size, old_size, new_size, alignment, ARENA_CALL_SITE());
+}
+
+void *Arena_ReallocUsed(Arena *arena, void *ptr, size_t old_size, size_t used_size, size_t new_size,
+                        size_t alignment) {
+  return arena_realloc_at(arena, ptr, old_size, used_size, new_size, alignment, ARENA_CALL_SITE());
 }
 
 // ============================================================================
@@ -364,8 +1302,11 @@ void Arena_Reset(Arena *arena) {
   if (!arena)
     return;
 
+  ARENA_TRACE(arena, ARENA_TRACE_RESET, NULL, Arena_GetUsed(arena), 0);
+
   switch (arena->type) {
     case ARENA_TYPE_BUMP:
+      arena_fold_peak(arena);
       arena->data.bump.offset = 0;
       arena->used = 0;
       break;
@@ -376,11 +1317,40 @@ void Arena_Reset(Arena *arena) {
       break;
 
     case ARENA_TYPE_STACK:
+      arena_fold_peak(arena);
       arena->data.stack.offset = 0;
       arena->used = 0;
       // Note: We keep peak_used for statistics
       break;
 
+    case ARENA_TYPE_CONCURRENT_BUMP:
+      // Must not race with allocation: callers reset at a sync point
+      Platform_AtomicMaxSize(&arena->peak_used, concurrent_bump_used(arena));
+      Platform_AtomicStoreSize(&arena->data.concurrent_bump.offset, 0);
+      arena->used = 0;
+      break;
+
+    case ARENA_TYPE_SCRATCH:
+      arena->data.scratch.offset = 0;
+      arena->used = 0;
+      break;
+
+    case ARENA_TYPE_MULTI_POOL:
+      for (size_t i = 0; i < ARENA_MULTI_POOL_CLASS_COUNT; ++i) {
+        Arena_Reset(arena->data.multi_pool.pools[i]);
+      }
+      multi_pool_fallback_release_all(arena, ARENA_CALL_SITE());
+      arena->used = 0;
+      break;
+
+    case ARENA_TYPE_BLOCK:
+      // Forget every outstanding block; they'll be re-carved from the base
+      arena->data.block.free_list = NULL;
+      arena->data.block.free_count = arena->data.block.block_count;
+      arena->data.block.carved_count = 0;
+      arena->used = 0;
+      break;
+
     default:
       Platform_LogError("Arena type %d not yet implemented for reset", arena->type);
       break;
@@ -391,11 +1361,23 @@ void Arena_Reset(Arena *arena) {
 // Arena Query Functions
 // ============================================================================
 size_t Arena_GetUsed(Arena *arena) {
-  return arena ? arena->used : 0;
+  if (arena && arena->type == ARENA_TYPE_CONCURRENT_BUMP) {
+    return concurrent_bump_used(arena);
+  }
+  return arena ? arena_used(arena) : 0;
 }
 
 size_t Arena_GetPeakUsed(Arena *arena) {
-  return arena ? arena->peak_used : 0;
+  if (!arena)
+    return 0;
+
+  if (arena->type == ARENA_TYPE_CONCURRENT_BUMP) {
+    // Peak is folded in lazily (here and on reset) to keep it off the allocation path
+    Platform_AtomicMaxSize(&arena->peak_used, concurrent_bump_used(arena));
+  } else {
+    arena_fold_peak(arena);
+  }
+  return arena->peak_used;
 }
 
 size_t Arena_GetCapacity(Arena *arena) {
@@ -420,8 +1402,11 @@ ArenaMarker Arena_Mark(Arena *arena) {
   if (arena->type == ARENA_TYPE_STACK) {
     marker.arena = arena;
     marker.offset = arena->data.stack.offset;
+  } else if (arena->type == ARENA_TYPE_VIRTUAL) {
+    marker.arena = arena;
+    marker.offset = arena->used;
   } else {
-    Platform_LogError("Arena_Mark only valid for ARENA_TYPE_STACK");
+    Platform_LogError("Arena_Mark only valid for ARENA_TYPE_STACK or ARENA_TYPE_VIRTUAL");
   }
 
   return marker;
@@ -440,10 +1425,23 @@ void Arena_PopTo(Arena *arena, ArenaMarker marker) {
     }
 
     // Pop back to the marked position
+    arena_fold_peak(arena);
+    ARENA_TRACE(arena, ARENA_TRACE_POP, NULL, arena->data.stack.offset - marker.offset, 0);
     arena->data.stack.offset = marker.offset;
     arena->used = marker.offset;
+  } else if (arena->type == ARENA_TYPE_VIRTUAL) {
+    if (marker.offset > arena->used) {
+      Platform_LogError("Invalid marker: trying to pop to future offset (%zu > %zu)",
+                        marker.offset, arena->used);
+      return;
+    }
+
+    // Popping the root past a loading spike is where RSS comes back down
+    ARENA_TRACE(arena, ARENA_TRACE_POP, NULL, arena->used - marker.offset, 0);
+    arena->used = marker.offset;
+    virtual_maybe_decommit(arena);
   } else {
-    Platform_LogError("Arena_PopTo only valid for ARENA_TYPE_STACK");
+    Platform_LogError("Arena_PopTo only valid for ARENA_TYPE_STACK or ARENA_TYPE_VIRTUAL");
   }
 }
 
@@ -457,15 +1455,19 @@ ArenaTemp Arena_BeginTemp(Arena *arena) {
 
   temp.arena = arena;
 
-  // Works with both Stack and Bump arenas
-  if (arena->type == ARENA_TYPE_STACK) {
+  // Works with Stack, Virtual, Bump and Scratch arenas
+  if (arena->type == ARENA_TYPE_STACK || arena->type == ARENA_TYPE_VIRTUAL) {
     temp.marker = Arena_Mark(arena);
   } else if (arena->type == ARENA_TYPE_BUMP) {
     // For Bump, we can fake it by saving the offset
     temp.marker.arena = arena;
     temp.marker.offset = arena->data.bump.offset;
+  } else if (arena->type == ARENA_TYPE_SCRATCH) {
+    temp.marker.arena = arena;
+    temp.marker.offset = arena->data.scratch.offset;
+    arena->data.scratch.temp_depth++;
   } else {
-    Platform_LogError("Arena_BeginTemp only works with STACK or BUMP arenas");
+    Platform_LogError("Arena_BeginTemp only works with STACK, VIRTUAL, BUMP or SCRATCH arenas");
   }
 
   return temp;
@@ -474,11 +1476,23 @@ ArenaTemp Arena_BeginTemp(Arena *arena) {
 void Arena_EndTemp(ArenaTemp temp) {
   if (!temp.arena) return;
 
-  if (temp.arena->type == ARENA_TYPE_STACK) {
+  if (temp.arena->type == ARENA_TYPE_STACK || temp.arena->type == ARENA_TYPE_VIRTUAL) {
     Arena_PopTo(temp.arena, temp.marker);
   } else if (temp.arena->type == ARENA_TYPE_BUMP) {
     // For Bump, restore the offset
+    arena_fold_peak(temp.arena);
+    ARENA_TRACE(temp.arena, ARENA_TRACE_POP, NULL, temp.arena->data.bump.offset - temp.marker.offset, 0);
     temp.arena->data.bump.offset = temp.marker.offset;
     temp.arena->used = temp.marker.offset;
+  } else if (temp.arena->type == ARENA_TYPE_SCRATCH) {
+    ScratchArenaData *scratch = &temp.arena->data.scratch;
+    ARENA_TRACE(temp.arena, ARENA_TRACE_POP, NULL, scratch->offset - temp.marker.offset, 0);
+    scratch->offset = temp.marker.offset;
+
+    // Nothing allocated from scratch outlives the outermost scope
+    if (scratch->temp_depth > 0 && --scratch->temp_depth == 0 && scratch->auto_reset) {
+      scratch->offset = 0;
+    }
+    temp.arena->used = scratch->offset;
   }
 }
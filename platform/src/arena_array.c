@@ -0,0 +1,173 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#include "arena_array.h"
+#include "platform.h"
+#include <stdio.h>
+#include <string.h>
+
+#define ARENA_ARRAY_MIN_CAPACITY 8
+#define ARENA_STRING_MIN_CAPACITY 64
+
+// Double until it fits (in-place extension makes over-reserving cheap, copies make it pay off)
+static size_t grow_capacity(size_t current, size_t required, size_t minimum) {
+  size_t capacity = current > minimum ? current : minimum;
+  while (capacity < required) {
+    capacity *= 2;
+  }
+  return capacity;
+}
+
+// ============================================================================
+// Arena Array
+// ============================================================================
+ArenaArray ArenaArray_Create(Arena *arena, size_t elem_size, size_t alignment, size_t initial_capacity) {
+  ArenaArray array = {0};
+  array.arena = arena;
+  array.elem_size = elem_size;
+  array.alignment = alignment ? alignment : DEFAULT_ALIGNMENT;
+
+  if (initial_capacity) {
+    ArenaArray_Reserve(&array, initial_capacity);
+  }
+  return array;
+}
+
+bool ArenaArray_Reserve(ArenaArray *array, size_t capacity) {
+  if (!array || !array->arena || array->elem_size == 0)
+    return false;
+  if (capacity <= array->capacity)
+    return true;
+
+  void *data = Arena_ReallocUsed(array->arena, array->data,
+                                 array->capacity * array->elem_size,
+                                 array->count * array->elem_size,
+                                 capacity * array->elem_size,
+                                 array->alignment);
+  if (!data) {
+    Platform_LogError("ArenaArray: failed to grow to %zu elements of %zu bytes", capacity, array->elem_size);
+    return false;
+  }
+
+  array->data = data;
+  array->capacity = capacity;
+  return true;
+}
+
+void *ArenaArray_PushN(ArenaArray *array, size_t count) {
+  if (!array)
+    return NULL;
+
+  size_t required = array->count + count;
+  if (required > array->capacity &&
+      !ArenaArray_Reserve(array, grow_capacity(array->capacity, required, ARENA_ARRAY_MIN_CAPACITY))) {
+    return NULL;
+  }
+
+  void *result = (char *)array->data + array->count * array->elem_size;
+  array->count = required;
+  return result;
+}
+
+void *ArenaArray_Push(ArenaArray *array) {
+  return ArenaArray_PushN(array, 1);
+}
+
+void ArenaArray_Clear(ArenaArray *array) {
+  if (array) {
+    array->count = 0;
+  }
+}
+
+// ============================================================================
+// Arena String Builder
+// ============================================================================
+static bool string_reserve(ArenaString *string, size_t capacity) {
+  if (capacity <= string->capacity)
+    return true;
+
+  capacity = grow_capacity(string->capacity, capacity, ARENA_STRING_MIN_CAPACITY);
+
+  // Copy the terminator too, so a moved string is still a valid C string
+  size_t used = string->data ? string->length + 1 : 0;
+  char *data = Arena_ReallocUsed(string->arena, string->data, string->capacity, used, capacity, 1);
+  if (!data) {
+    Platform_LogError("ArenaString: failed to grow to %zu bytes", capacity);
+    return false;
+  }
+
+  string->data = data;
+  string->capacity = capacity;
+  return true;
+}
+
+ArenaString ArenaString_Create(Arena *arena, size_t initial_capacity) {
+  ArenaString string = {0};
+  string.arena = arena;
+
+  if (string_reserve(&string, initial_capacity ? initial_capacity : 1)) {
+    string.data[0] = '\0';
+  }
+  return string;
+}
+
+bool ArenaString_Append(ArenaString *string, const char *str, size_t len) {
+  if (!string || !string->arena || (!str && len))
+    return false;
+
+  if (!string_reserve(string, string->length + len + 1))
+    return false;
+
+  memcpy(string->data + string->length, str, len);
+  string->length += len;
+  string->data[string->length] = '\0';
+  return true;
+}
+
+bool ArenaString_AppendCStr(ArenaString *string, const char *str) {
+  return str ? ArenaString_Append(string, str, strlen(str)) : false;
+}
+
+bool ArenaString_AppendfV(ArenaString *string, const char *fmt, va_list args) {
+  if (!string || !string->arena || !fmt)
+    return false;
+
+  // Try to format into the existing slack first; only measure-and-retry when it doesn't fit
+  va_list measure;
+  va_copy(measure, args);
+  size_t available = string->data ? string->capacity - string->length : 0;
+  int needed = vsnprintf(available ? string->data + string->length : NULL, available, fmt, measure);
+  va_end(measure);
+
+  if (needed < 0)
+    return false;
+
+  if ((size_t)needed >= available) {
+    if (!string_reserve(string, string->length + (size_t)needed + 1)) {
+      // The truncated attempt overwrote our terminator
+      if (string->data) {
+        string->data[string->length] = '\0';
+      }
+      return false;
+    }
+    vsnprintf(string->data + string->length, (size_t)needed + 1, fmt, args);
+  }
+
+  string->length += (size_t)needed;
+  return true;
+}
+
+bool ArenaString_Appendf(ArenaString *string, const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  bool result = ArenaString_AppendfV(string, fmt, args);
+  va_end(args);
+  return result;
+}
+
+void ArenaString_Clear(ArenaString *string) {
+  if (string && string->data) {
+    string->length = 0;
+    string->data[0] = '\0';
+  }
+}
@@ -0,0 +1,294 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#include "arena_handle.h"
+#include "platform.h"
+#include <stdint.h>
+#include <string.h>
+
+// Every heap block starts with a header so the compactor can walk the heap linearly
+// and find the slot that owns each block. Keeps payloads ARENA_HANDLE_ALIGNMENT aligned.
+typedef struct HandleBlockHeader {
+  uint32_t slot;     // Owning slot index + 1 (0 = hole)
+  uint32_t size;     // Payload bytes following the header
+  uint64_t reserved; // Pad to ARENA_HANDLE_ALIGNMENT
+} HandleBlockHeader;
+
+#define HANDLE_HEADER_SIZE sizeof(HandleBlockHeader)
+#define HANDLE_GENERATION_MAX ((1u << (32 - ARENA_HANDLE_INDEX_BITS)) - 1)
+
+static size_t align_size(size_t size, size_t alignment) {
+  return ALIGN_UP(size, alignment);
+}
+
+static HandleBlockHeader *block_at(const HandleArena *handles, size_t offset) {
+  return (HandleBlockHeader *)(handles->heap + offset);
+}
+
+// Slot for a live handle, or NULL
+static ArenaHandleSlot *handle_slot(HandleArena *handles, ArenaHandle handle) {
+  if (!handles || !HandleArena_Resolve(handles, handle))
+    return NULL;
+  return &handles->slots[handle & ARENA_HANDLE_INDEX_MASK];
+}
+
+// ============================================================================
+// Creation / Destruction
+// ============================================================================
+HandleArena *HandleArena_Create(Arena *parent, size_t heap_size, uint32_t max_handles) {
+  if (!parent || heap_size == 0 || max_handles == 0)
+    return NULL;
+
+  if (heap_size > UINT32_MAX || max_handles > ARENA_HANDLE_MAX_SLOTS) {
+    Platform_LogError("Handle arena limited to 4GB heap and %u handles (asked for %zu bytes, %u handles)",
+                      ARENA_HANDLE_MAX_SLOTS, heap_size, max_handles);
+    return NULL;
+  }
+
+  heap_size = align_size(heap_size, ARENA_HANDLE_ALIGNMENT);
+  size_t header_size = align_size(sizeof(HandleArena), ARENA_HANDLE_ALIGNMENT);
+  size_t slots_size = align_size(sizeof(ArenaHandleSlot) * max_handles, ARENA_HANDLE_ALIGNMENT);
+
+  // Struct, slot table and heap share one child arena so the whole thing shows up
+  // (and is destroyed) as a single node in the hierarchy
+  Arena *storage = Arena_CreateBump(parent, header_size + slots_size + heap_size, ARENA_HANDLE_ALIGNMENT);
+  if (!storage) {
+    Platform_LogError("Failed to create handle arena storage");
+    return NULL;
+  }
+  Arena_SetDebugName(storage, "HandleArena");
+
+  HandleArena *handles = Arena_AllocAligned(storage, header_size, ARENA_HANDLE_ALIGNMENT);
+  memset(handles, 0, sizeof(HandleArena));
+  handles->storage = storage;
+  handles->slots = Arena_AllocAligned(storage, slots_size, ARENA_HANDLE_ALIGNMENT);
+  handles->max_slots = max_handles;
+  handles->heap = Arena_AllocAligned(storage, heap_size, ARENA_HANDLE_ALIGNMENT);
+  handles->heap_size = heap_size;
+
+  Platform_Log("Handle arena created: %zu KB heap, %u handles", heap_size / 1024, max_handles);
+  return handles;
+}
+
+void HandleArena_Destroy(HandleArena *handles) {
+  if (handles) {
+    Arena_Destroy(handles->storage);
+  }
+}
+
+// ============================================================================
+// Alloc / Free
+// ============================================================================
+static uint32_t slot_acquire(HandleArena *handles) {
+  if (handles->free_slot_head) {
+    uint32_t index = handles->free_slot_head - 1;
+    handles->free_slot_head = handles->slots[index].next_free;
+    return index;
+  }
+
+  if (handles->slot_count < handles->max_slots) {
+    uint32_t index = handles->slot_count++;
+    handles->slots[index].generation = 1;
+    return index;
+  }
+
+  return UINT32_MAX;
+}
+
+// First-fit search of the holes below top (slow path only, when top is full and no
+// compaction pass is in progress). Splits the hole when the rest is big enough to
+// stay a hole. Returns the block offset, or SIZE_MAX.
+static size_t hole_take(HandleArena *handles, size_t payload) {
+  size_t offset = 0;
+  while (offset < handles->top) {
+    HandleBlockHeader *header = block_at(handles, offset);
+    size_t block = HANDLE_HEADER_SIZE + header->size;
+
+    if (header->slot == 0 && header->size >= payload) {
+      size_t remainder = header->size - payload;
+      if (remainder >= HANDLE_HEADER_SIZE + ARENA_HANDLE_ALIGNMENT) {
+        HandleBlockHeader *rest = block_at(handles, offset + HANDLE_HEADER_SIZE + payload);
+        rest->slot = 0;
+        rest->size = (uint32_t)(remainder - HANDLE_HEADER_SIZE);
+        header->size = (uint32_t)payload;
+      }
+      handles->hole_bytes -= HANDLE_HEADER_SIZE + header->size;
+      return offset;
+    }
+    offset += block;
+  }
+  return SIZE_MAX;
+}
+
+ArenaHandle HandleArena_Alloc(HandleArena *handles, size_t size) {
+  if (!handles || size == 0 || size > UINT32_MAX)
+    return ARENA_HANDLE_INVALID;
+
+  size_t payload = align_size(size, ARENA_HANDLE_ALIGNMENT);
+  size_t block = HANDLE_HEADER_SIZE + payload;
+
+  size_t block_offset = handles->top;
+  if (block > handles->heap_size - handles->top) {
+    if (block > handles->heap_size - handles->top + handles->hole_bytes) {
+      Platform_LogError("Handle arena out of memory (%zu bytes requested, %zu free)",
+                        size, handles->heap_size - handles->top + handles->hole_bytes);
+      return ARENA_HANDLE_INVALID;
+    }
+
+    // Top is full but holes add up to enough. Reuse a hole if one fits (holes sealed in
+    // front of pinned blocks never reach the top otherwise)...
+    block_offset = handles->compact_scan == 0 ? hole_take(handles, payload) : SIZE_MAX;
+    if (block_offset == SIZE_MAX) {
+      // ...else finish any pass in progress and run one full pass. This is the hitch
+      // incremental compaction is meant to avoid.
+      Platform_LogWarning("Handle arena fragmented: compacting synchronously for %zu bytes", size);
+      HandleArena_Compact(handles, SIZE_MAX);
+      HandleArena_Compact(handles, SIZE_MAX);
+
+      block_offset = block <= handles->heap_size - handles->top ? handles->top : hole_take(handles, payload);
+      if (block_offset == SIZE_MAX) {
+        Platform_LogError("Handle arena out of memory after compaction (%zu bytes requested)", size);
+        return ARENA_HANDLE_INVALID;
+      }
+    }
+  }
+
+  uint32_t index = slot_acquire(handles);
+  if (index == UINT32_MAX) {
+    Platform_LogError("Handle arena out of handles (%u)", handles->max_slots);
+    if (block_offset != handles->top) {
+      block_at(handles, block_offset)->slot = 0;
+      handles->hole_bytes += HANDLE_HEADER_SIZE + block_at(handles, block_offset)->size;
+    }
+    return ARENA_HANDLE_INVALID;
+  }
+
+  HandleBlockHeader *header = block_at(handles, block_offset);
+  header->slot = index + 1;
+  if (block_offset == handles->top) {
+    header->size = (uint32_t)payload;
+    handles->top += block;
+  }
+
+  ArenaHandleSlot *slot = &handles->slots[index];
+  slot->offset = (uint32_t)(block_offset + HANDLE_HEADER_SIZE);
+  slot->size = header->size;
+  slot->pin_count = 0;
+  slot->next_free = 0;
+
+  handles->live_count++;
+
+  return ((ArenaHandle)slot->generation << ARENA_HANDLE_INDEX_BITS) | index;
+}
+
+void HandleArena_Free(HandleArena *handles, ArenaHandle handle) {
+  ArenaHandleSlot *slot = handle_slot(handles, handle);
+  if (!slot) {
+#ifndef NDEBUG
+    if (handles && handle != ARENA_HANDLE_INVALID) {
+      Platform_LogError("HandleArena_Free: stale or invalid handle 0x%08x", handle);
+    }
+#endif
+    return;
+  }
+
+  uint32_t index = handle & ARENA_HANDLE_INDEX_MASK;
+  size_t block_offset = slot->offset - HANDLE_HEADER_SIZE;
+  size_t block = HANDLE_HEADER_SIZE + slot->size;
+
+  // The topmost block (outside any in-progress pass) just lowers top; anything else is a hole
+  if (block_offset + block == handles->top && block_offset >= handles->compact_scan) {
+    handles->top = block_offset;
+  } else {
+    block_at(handles, block_offset)->slot = 0;
+    handles->hole_bytes += block;
+  }
+
+  // Bump the generation so outstanding copies of the handle stop resolving
+  slot->generation = (uint16_t)(slot->generation >= HANDLE_GENERATION_MAX ? 1 : slot->generation + 1);
+  slot->pin_count = 0;
+  slot->next_free = handles->free_slot_head;
+  handles->free_slot_head = index + 1;
+  handles->live_count--;
+}
+
+void HandleArena_Pin(HandleArena *handles, ArenaHandle handle) {
+  ArenaHandleSlot *slot = handle_slot(handles, handle);
+  if (slot) {
+    slot->pin_count++;
+  }
+}
+
+void HandleArena_Unpin(HandleArena *handles, ArenaHandle handle) {
+  ArenaHandleSlot *slot = handle_slot(handles, handle);
+  if (slot && slot->pin_count > 0) {
+    slot->pin_count--;
+  }
+}
+
+// ============================================================================
+// Incremental Compaction
+// ============================================================================
+// A pass walks blocks from the bottom of the heap, sliding live blocks down to
+// compact_dest. The gap [compact_dest, compact_scan) is always made of reclaimed holes.
+// A pinned block can't move, so the gap before it is sealed back into a single hole
+// and the pass carries on after it.
+size_t HandleArena_Compact(HandleArena *handles, size_t max_bytes) {
+  if (!handles)
+    return 0;
+
+  bool in_progress = handles->compact_scan != 0;
+  if (!in_progress && handles->hole_bytes == 0)
+    return 0;
+
+  size_t moved = 0;
+  size_t work = 0; // Moved bytes plus a header's worth per block visited, so walking is bounded too
+  size_t scan = handles->compact_scan;
+  size_t dest = handles->compact_dest;
+
+  while (scan < handles->top && work < max_bytes) {
+    HandleBlockHeader *header = block_at(handles, scan);
+    size_t block = HANDLE_HEADER_SIZE + header->size;
+    work += HANDLE_HEADER_SIZE;
+
+    if (header->slot == 0) {
+      // Hole: widen the gap
+      scan += block;
+      continue;
+    }
+
+    ArenaHandleSlot *slot = &handles->slots[header->slot - 1];
+    if (slot->pin_count > 0) {
+      if (scan != dest) {
+        HandleBlockHeader *hole = block_at(handles, dest);
+        hole->slot = 0;
+        hole->size = (uint32_t)(scan - dest - HANDLE_HEADER_SIZE);
+      }
+      scan += block;
+      dest = scan;
+      continue;
+    }
+
+    if (scan != dest) {
+      memmove(handles->heap + dest, handles->heap + scan, block);
+      slot->offset = (uint32_t)(dest + HANDLE_HEADER_SIZE);
+      moved += block;
+      work += block;
+    }
+    scan += block;
+    dest += block;
+  }
+
+  if (scan >= handles->top) {
+    // Pass complete: everything above dest was holes
+    handles->hole_bytes -= handles->top - dest;
+    handles->top = dest;
+    scan = 0;
+    dest = 0;
+  }
+
+  handles->compact_scan = scan;
+  handles->compact_dest = dest;
+  handles->bytes_moved_total += moved;
+  return moved;
+}
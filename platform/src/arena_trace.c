@@ -0,0 +1,323 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#include "arena_trace.h"
+#include "arena.h"
+#include "platform.h"
+#include "platform_atomic.h"
+#include <stdio.h>
+#include <string.h>
+
+#define ARENA_DUMP_MAGIC 0x44414C46u // "FLAD"
+#define ARENA_DUMP_VERSION 1
+#define ARENA_DUMP_PATH_MAX 512
+
+static uint64_t g_trace_frame = 0;
+
+static char g_dump_prefix[ARENA_DUMP_PATH_MAX];
+static uint32_t g_dump_interval = 0;
+static ArenaDumpFormat g_dump_format = ARENA_DUMP_JSON;
+
+// ============================================================================
+// Ring Buffer
+// ============================================================================
+#ifdef FLIGHT_ENABLE_ARENA_TRACE
+
+#if (ARENA_TRACE_CAPACITY & (ARENA_TRACE_CAPACITY - 1)) != 0
+#error "ARENA_TRACE_CAPACITY must be a power of 2"
+#endif
+
+static ArenaTraceEvent g_trace_events[ARENA_TRACE_CAPACITY];
+static volatile size_t g_trace_write_index = 0; // Total events ever recorded
+
+void Arena_TraceRecord(const Arena *arena, ArenaTraceKind kind, const void *ptr,
+                       size_t size, size_t alignment, const void *call_site) {
+  // Claim a slot; writers never wait on each other or on readers
+  size_t index = Platform_AtomicFetchAddSize(&g_trace_write_index, 1);
+  ArenaTraceEvent *event = &g_trace_events[index & (ARENA_TRACE_CAPACITY - 1)];
+  event->frame = g_trace_frame;
+  event->arena = arena;
+  event->ptr = ptr;
+  event->call_site = call_site;
+  event->size = size;
+  event->alignment = (uint32_t)alignment;
+  event->kind = (uint32_t)kind;
+}
+
+size_t Arena_TraceGetEvents(ArenaTraceEvent *out_events, size_t max_events) {
+  if (!out_events || max_events == 0)
+    return 0;
+
+  size_t end = Platform_AtomicLoadSize(&g_trace_write_index);
+  size_t available = end < ARENA_TRACE_CAPACITY ? end : ARENA_TRACE_CAPACITY;
+  size_t count = available < max_events ? available : max_events;
+
+  for (size_t i = 0; i < count; ++i) {
+    out_events[i] = g_trace_events[(end - count + i) & (ARENA_TRACE_CAPACITY - 1)];
+  }
+  return count;
+}
+
+#else
+
+size_t Arena_TraceGetEvents(ArenaTraceEvent *out_events, size_t max_events) {
+  (void)out_events;
+  (void)max_events;
+  return 0;
+}
+
+#endif
+
+uint64_t Arena_TraceGetFrame(void) {
+  return g_trace_frame;
+}
+
+// ============================================================================
+// Per-Arena Stats
+// ============================================================================
+typedef struct ArenaDumpStats {
+  size_t used;
+  size_t peak;
+  size_t capacity;
+  size_t committed;          // Physically backed bytes (virtual/thread scratch), else capacity
+  size_t fragmentation_bytes; // Free space stranded between live allocations
+} ArenaDumpStats;
+
+static const char *arena_type_name(ArenaType type) {
+  switch (type) {
+    case ARENA_TYPE_VIRTUAL: return "virtual";
+    case ARENA_TYPE_BUMP: return "bump";
+    case ARENA_TYPE_STACK: return "stack";
+    case ARENA_TYPE_BLOCK: return "block";
+    case ARENA_TYPE_MULTI_POOL: return "multi_pool";
+    case ARENA_TYPE_SCRATCH: return "scratch";
+    case ARENA_TYPE_CONCURRENT_BUMP: return "concurrent_bump";
+    default: return "unknown";
+  }
+}
+
+static ArenaDumpStats arena_dump_stats(Arena *arena) {
+  ArenaDumpStats stats = {0};
+  stats.used = Arena_GetUsed(arena);
+  stats.peak = Arena_GetPeakUsed(arena);
+  stats.capacity = Arena_GetCapacity(arena);
+  stats.committed = stats.capacity;
+
+  switch (arena->type) {
+    case ARENA_TYPE_VIRTUAL:
+      stats.committed = arena->data.virtual_mem.commit_size;
+      break;
+
+    case ARENA_TYPE_SCRATCH:
+      if (arena->data.scratch.commit_size) {
+        stats.committed = arena->data.scratch.commit_size;
+      }
+      break;
+
+    case ARENA_TYPE_BLOCK: {
+      // Freed blocks below the carve line are holes; the uncarved tail is still contiguous
+      const BlockArenaData *block = &arena->data.block;
+      size_t live = block->block_count - block->free_count;
+      stats.fragmentation_bytes = (block->carved_count - live) * block->block_size;
+      break;
+    }
+
+    case ARENA_TYPE_MULTI_POOL:
+      for (size_t i = 0; i < ARENA_MULTI_POOL_CLASS_COUNT; ++i) {
+        stats.fragmentation_bytes += arena_dump_stats(arena->data.multi_pool.pools[i]).fragmentation_bytes;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  return stats;
+}
+
+// ============================================================================
+// JSON Dump
+// ============================================================================
+static void json_write_string(FILE *file, const char *str) {
+  fputc('"', file);
+  for (; str && *str; ++str) {
+    unsigned char c = (unsigned char)*str;
+    if (c == '"' || c == '\\') {
+      fputc('\\', file);
+      fputc(c, file);
+    } else if (c < 0x20) {
+      fprintf(file, "\\u%04x", c);
+    } else {
+      fputc(c, file);
+    }
+  }
+  fputc('"', file);
+}
+
+static void json_write_arena(FILE *file, Arena *arena, int depth) {
+  ArenaDumpStats stats = arena_dump_stats(arena);
+  double fragmentation = stats.capacity ? (double)stats.fragmentation_bytes / (double)stats.capacity : 0.0;
+
+  fprintf(file, "%*s{\"name\": ", depth * 2, "");
+  json_write_string(file, arena->debug_name ? arena->debug_name : "unnamed");
+  fprintf(file, ", \"type\": \"%s\", \"address\": \"%p\", \"used\": %zu, \"peak\": %zu, "
+                "\"capacity\": %zu, \"committed\": %zu, \"fragmentation\": %.4f, \"children\": [",
+          arena_type_name(arena->type), (void *)arena, stats.used, stats.peak,
+          stats.capacity, stats.committed, fragmentation);
+
+  if (arena->first_child) {
+    fputc('\n', file);
+    for (Arena *child = arena->first_child; child; child = child->next_sibling) {
+      json_write_arena(file, child, depth + 1);
+      fputs(child->next_sibling ? ",\n" : "\n", file);
+    }
+    fprintf(file, "%*s", depth * 2, "");
+  }
+  fputs("]}", file);
+}
+
+static void json_write_events(FILE *file, const ArenaTraceEvent *events, size_t count) {
+  static const char *kind_names[] = {"alloc", "free", "extend", "pop", "reset"};
+
+  fputs(",\n  \"events\": [", file);
+  for (size_t i = 0; i < count; ++i) {
+    const ArenaTraceEvent *event = &events[i];
+    fprintf(file, "%s\n    {\"frame\": %llu, \"kind\": \"%s\", \"arena\": \"%p\", \"ptr\": \"%p\", "
+                  "\"size\": %llu, \"alignment\": %u, \"call_site\": \"%p\"}",
+            i ? "," : "", (unsigned long long)event->frame,
+            event->kind <= ARENA_TRACE_RESET ? kind_names[event->kind] : "unknown",
+            (const void *)event->arena, event->ptr, (unsigned long long)event->size,
+            event->alignment, event->call_site);
+  }
+  fputs(count ? "\n  ]" : "]", file);
+}
+
+// ============================================================================
+// Binary Dump
+// ============================================================================
+// Native-endian, fixed-size records so a viewer can mmap and walk it:
+//   ArenaDumpHeader, node_count x (ArenaDumpNode + name_length bytes), event_count x ArenaTraceEvent
+typedef struct ArenaDumpHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t frame;
+  uint32_t node_count;
+  uint32_t event_count;
+} ArenaDumpHeader;
+
+typedef struct ArenaDumpNode {
+  uint64_t address;
+  uint64_t used;
+  uint64_t peak;
+  uint64_t capacity;
+  uint64_t committed;
+  uint64_t fragmentation_bytes;
+  uint16_t depth; // Pre-order depth; parent is the nearest earlier node at depth - 1
+  uint16_t type;  // ArenaType
+  uint16_t name_length;
+  uint16_t reserved;
+} ArenaDumpNode;
+
+static uint32_t binary_write_arena(FILE *file, Arena *arena, uint16_t depth) {
+  ArenaDumpStats stats = arena_dump_stats(arena);
+  const char *name = arena->debug_name ? arena->debug_name : "";
+
+  ArenaDumpNode node = {
+      .address = (uint64_t)(uintptr_t)arena,
+      .used = stats.used,
+      .peak = stats.peak,
+      .capacity = stats.capacity,
+      .committed = stats.committed,
+      .fragmentation_bytes = stats.fragmentation_bytes,
+      .depth = depth,
+      .type = (uint16_t)arena->type,
+      .name_length = (uint16_t)strlen(name),
+  };
+  fwrite(&node, sizeof(node), 1, file);
+  fwrite(name, 1, node.name_length, file);
+
+  uint32_t count = 1;
+  for (Arena *child = arena->first_child; child; child = child->next_sibling) {
+    count += binary_write_arena(file, child, (uint16_t)(depth + 1));
+  }
+  return count;
+}
+
+// ============================================================================
+// Dump Entry Points
+// ============================================================================
+bool Arena_DumpHierarchy(Arena *root, const char *path, ArenaDumpFormat format) {
+  if (!root || !path)
+    return false;
+
+  FILE *file = fopen(path, format == ARENA_DUMP_BINARY ? "wb" : "w");
+  if (!file) {
+    Platform_LogError("Arena dump: can't open '%s' for writing", path);
+    return false;
+  }
+
+  // Snapshot events up front so the dump doesn't trace its own (possible) allocations
+  ArenaTraceEvent *events = NULL;
+  size_t event_count = 0;
+#ifdef FLIGHT_ENABLE_ARENA_TRACE
+  static ArenaTraceEvent s_snapshot[ARENA_TRACE_CAPACITY];
+  events = s_snapshot;
+  event_count = Arena_TraceGetEvents(events, ARENA_TRACE_CAPACITY);
+#endif
+
+  if (format == ARENA_DUMP_BINARY) {
+    ArenaDumpHeader header = {
+        .magic = ARENA_DUMP_MAGIC,
+        .version = ARENA_DUMP_VERSION,
+        .frame = g_trace_frame,
+        .event_count = (uint32_t)event_count,
+    };
+    fwrite(&header, sizeof(header), 1, file);
+    header.node_count = binary_write_arena(file, root, 0);
+    if (event_count) {
+      fwrite(events, sizeof(ArenaTraceEvent), event_count, file);
+    }
+
+    // Patch the node count now that the tree has been walked
+    fseek(file, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, file);
+  } else {
+    fprintf(file, "{\n  \"frame\": %llu,\n  \"root\":\n", (unsigned long long)g_trace_frame);
+    json_write_arena(file, root, 1);
+    json_write_events(file, events, event_count);
+    fputs("\n}\n", file);
+  }
+
+  bool ok = !ferror(file);
+  if (fclose(file) != 0) {
+    ok = false;
+  }
+  if (!ok) {
+    Platform_LogError("Arena dump: write to '%s' failed", path);
+  }
+  return ok;
+}
+
+void Arena_TraceConfigureDump(const char *path_prefix, uint32_t interval_frames, ArenaDumpFormat format) {
+  if (!path_prefix || interval_frames == 0) {
+    g_dump_interval = 0;
+    return;
+  }
+
+  snprintf(g_dump_prefix, sizeof(g_dump_prefix), "%s", path_prefix);
+  g_dump_interval = interval_frames;
+  g_dump_format = format;
+  Platform_Log("Arena dump: writing '%s_<frame>' every %u frames", g_dump_prefix, interval_frames);
+}
+
+void Arena_TraceEndFrame(Arena *root) {
+  g_trace_frame++;
+
+  if (g_dump_interval == 0 || g_trace_frame % g_dump_interval != 0)
+    return;
+
+  char path[ARENA_DUMP_PATH_MAX + 32];
+  snprintf(path, sizeof(path), "%s_%llu.%s", g_dump_prefix, (unsigned long long)g_trace_frame,
+           g_dump_format == ARENA_DUMP_BINARY ? "bin" : "json");
+  Arena_DumpHierarchy(root, path, g_dump_format);
+}
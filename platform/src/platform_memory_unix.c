@@ -1,10 +1,14 @@
 #if defined(__unix__) || defined(__APPLE__)
 
 #include "platform.h"
+#include "platform_atomic.h"
 #include "platform_memory.h"
 #include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
+#include <time.h>
 #include <unistd.h>
 
 #ifdef __APPLE__
@@ -25,6 +29,61 @@ void *Platform_MemoryReserve(size_t size) {
   return ptr;
 }
 
+void *Platform_MemoryReserveHuge(size_t size) {
+#if defined(__linux__) && defined(MAP_HUGETLB)
+  // No MAP_NORESERVE: the kernel claims pool pages for the whole range up front, so an
+  // undersized pool fails here (and the caller falls back) instead of SIGBUS on first touch
+  void *ptr = mmap(NULL, size, PROT_NONE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+  if (ptr == MAP_FAILED) {
+    Platform_LogWarning("mmap(MAP_HUGETLB) failed: %s", strerror(errno));
+    return NULL;
+  }
+
+  return ptr;
+#else
+  (void)size;
+  return NULL;
+#endif
+}
+
+bool Platform_MemoryAdviseHugePages(void *ptr, size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  // Only 2MB-aligned sub-ranges get huge pages, so an unaligned head is lost (at most 2MB)
+  if (madvise(ptr, size, MADV_HUGEPAGE) != 0) {
+    Platform_LogWarning("madvise(MADV_HUGEPAGE) failed: %s", strerror(errno));
+    return false;
+  }
+  return true;
+#else
+  (void)ptr;
+  (void)size;
+  return false;
+#endif
+}
+
+void Platform_MemoryPrefault(void *ptr, size_t size) {
+#if defined(__linux__) && defined(MADV_POPULATE_WRITE)
+  // One syscall populates the range (Linux 5.14+); fall through to touching pages otherwise
+  if (madvise(ptr, size, MADV_POPULATE_WRITE) == 0) {
+    return;
+  }
+  if (errno != EINVAL) {
+    // Supported but couldn't back the range; touching it would just fault the same way
+    Platform_LogWarning("madvise(MADV_POPULATE_WRITE) failed: %s", strerror(errno));
+    return;
+  }
+#endif
+
+  // Write one byte per page. Memory is freshly committed (zero), so writing zero is harmless.
+  size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  volatile char *bytes = (volatile char *)ptr;
+  for (size_t offset = 0; offset < size; offset += page_size) {
+    bytes[offset] = 0;
+  }
+}
+
 bool Platform_MemoryCommit(void *ptr, size_t size) {
   // Change protection to allow read/write
   if (mprotect(ptr, size, PROT_READ | PROT_WRITE) != 0) {
@@ -56,6 +115,59 @@ void Platform_MemoryRelease(void *ptr, size_t size) {
   }
 }
 
+#ifdef __linux__
+// The /proc reads are file I/O, so they're kept off the per-call path: the huge page size is read
+// once, and this process's huge page usage at most once a second (whichever caller gets there
+// first refreshes it; the others see the previous second's value).
+static volatile size_t g_huge_page_size;      // 0 until read (and stays 0 without huge pages)
+static volatile size_t g_huge_page_size_read; // Nonzero once /proc/meminfo has been read
+static volatile size_t g_huge_page_bytes;
+static volatile size_t g_huge_page_bytes_stamp; // CLOCK_MONOTONIC second of the last read, + 1
+
+// Sum of the "<key> N kB" lines of a /proc file, for any of the keys
+static size_t memory_read_proc_kb(const char *path, const char *const *keys, size_t key_count) {
+  size_t total = 0;
+  char line[256];
+  FILE *file = fopen(path, "r");
+  if (!file)
+    return 0;
+
+  while (fgets(line, sizeof(line), file)) {
+    for (size_t i = 0; i < key_count; ++i) {
+      size_t key_length = strlen(keys[i]);
+      if (strncmp(line, keys[i], key_length) == 0) {
+        total += (size_t)strtoul(line + key_length, NULL, 10) * 1024;
+        break;
+      }
+    }
+  }
+  fclose(file);
+  return total;
+}
+
+static size_t memory_huge_page_size(void) {
+  if (!Platform_AtomicLoadSize(&g_huge_page_size_read)) {
+    static const char *const keys[] = {"Hugepagesize:"};
+    Platform_AtomicStoreSize(&g_huge_page_size, memory_read_proc_kb("/proc/meminfo", keys, 1));
+    Platform_AtomicStoreSize(&g_huge_page_size_read, 1);
+  }
+  return Platform_AtomicLoadSize(&g_huge_page_size);
+}
+
+static size_t memory_huge_page_bytes(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  size_t stamp = (size_t)now.tv_sec + 1;
+
+  size_t last = Platform_AtomicLoadSize(&g_huge_page_bytes_stamp);
+  if (last != stamp && Platform_AtomicCompareExchangeSize(&g_huge_page_bytes_stamp, &last, stamp)) {
+    static const char *const keys[] = {"AnonHugePages:", "Private_Hugetlb:"};
+    Platform_AtomicStoreSize(&g_huge_page_bytes, memory_read_proc_kb("/proc/self/smaps_rollup", keys, 2));
+  }
+  return Platform_AtomicLoadSize(&g_huge_page_bytes);
+}
+#endif
+
 PlatformMemoryStats Platform_MemoryGetStats(void) {
   PlatformMemoryStats stats = {0};
 
@@ -73,6 +185,10 @@ PlatformMemoryStats Platform_MemoryGetStats(void) {
     stats.total_physical = (size_t)pages * stats.page_size;
     stats.available_physical = (size_t)avail_pages * stats.page_size;
   }
+
+  // Huge page size and how much of this process is currently backed by huge pages
+  stats.huge_page_size = memory_huge_page_size();
+  stats.huge_page_bytes = memory_huge_page_bytes();
 #elif defined(__APPLE__)
   mach_msg_type_number_t count = HOST_VM_INFO_COUNT;
   vm_statistics_data_t vm_stat;
@@ -19,6 +19,24 @@ void *Platform_MemoryReserve(size_t size) {
   return ptr;
 }
 
+void *Platform_MemoryReserveHuge(size_t size) {
+  // No huge pages in WASM
+  (void)size;
+  return NULL;
+}
+
+bool Platform_MemoryAdviseHugePages(void *ptr, size_t size) {
+  (void)ptr;
+  (void)size;
+  return false;
+}
+
+void Platform_MemoryPrefault(void *ptr, size_t size) {
+  // Linear memory is already backed
+  (void)ptr;
+  (void)size;
+}
+
 bool Platform_MemoryCommit(void *ptr, size_t size) {
   // In WASM, memory is already committed
   (void)ptr;
@@ -14,6 +14,31 @@ void *Platform_MemoryReserve(size_t size) {
   return ptr;
 }
 
+void *Platform_MemoryReserveHuge(size_t size) {
+  // Large pages on Windows must be committed at reservation time and need
+  // SeLockMemoryPrivilege, which doesn't fit reserve-then-commit arenas.
+  (void)size;
+  return NULL;
+}
+
+bool Platform_MemoryAdviseHugePages(void *ptr, size_t size) {
+  // No transparent huge pages on Windows
+  (void)ptr;
+  (void)size;
+  return false;
+}
+
+void Platform_MemoryPrefault(void *ptr, size_t size) {
+  SYSTEM_INFO si;
+  GetSystemInfo(&si);
+
+  // Touch one byte per page; committed memory is zeroed, so writing zero is harmless
+  volatile char *bytes = (volatile char *)ptr;
+  for (size_t offset = 0; offset < size; offset += si.dwPageSize) {
+    bytes[offset] = 0;
+  }
+}
+
 bool Platform_MemoryCommit(void *ptr, size_t size) {
   void *result = VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE);
 
@@ -47,6 +72,7 @@ PlatformMemoryStats Platform_MemoryGetStats(void) {
 
   stats.page_size = si.dwPageSize;
   stats.allocation_granularity = si.dwAllocationGranularity;
+  stats.huge_page_size = GetLargePageMinimum();
 
   MEMORYSTATUSEX mem_status;
   mem_status.dwLength = sizeof(mem_status);
@@ -1,9 +1,17 @@
 // Copyright (c) 2025 Andrew Carroll Games, LLC
 // All rights reserved.
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // memfd_create
+#endif
+
 #include "platform.h"
+#include "platform_atomic.h"
 #include "platform_plugin.h"
 #include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -11,57 +19,397 @@
 #include <time.h>
 #include <unistd.h>
 
-struct PlatformPlugin {
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <sys/mman.h>
+#include <sys/sendfile.h>
+
+// How long the plugin file has to stay quiet (no further writes, same size) after the last
+// close-after-write before it's reported as changed. Linkers and strip can write the output
+// more than once; this keeps a half-written .so from ever reaching dlopen.
+#define PLUGIN_RELOAD_DEBOUNCE_NS 150000000ull // 150ms
+#endif
+
+// One loaded copy of the plugin. The original file is never dlopen'd, so the build can
+// overwrite it while the game keeps running.
+typedef struct PluginImage {
   void *handle;
+
+  // Linux: memfd holding the copy, kept open while loaded so each image has a distinct
+  // /proc/self/fd path. -1 otherwise.
+  int fd;
+
+  // Elsewhere: copy on disk next to the original ("<path>.<pid>.<n>.tmp"). Empty otherwise.
+  char temp_path[256 + 32];
+} PluginImage;
+
+struct PlatformPlugin {
+  Arena *arena; // Record owner (NULL = root arena, never freed)
+  PluginImage image;   // Current build: what symbols resolve against
+  PluginImage staged;  // Loaded by the reload thread, waiting to be swapped in
+  PluginImage retired; // Build before the last swap, kept for Platform_PluginRevertReload
   char path[256];
-  char temp_path[256];
+  uint32_t copy_count; // Keeps temp copy names unique within a process
   time_t last_mtime;
+
+  // Async reload: the thread owns staged/retired/copy_count while status is LOADING
+  pthread_t reload_thread;
+  bool reload_thread_running;    // Started and not yet joined
+  volatile size_t reload_status; // PlatformPluginReloadStatus
+
+#ifdef __linux__
+  // Change detection: a non-blocking inotify fd on the plugin's directory, drained once per
+  // check. -1 falls back to stat() polling.
+  int watch_fd;
+  const char *file_name;   // Points into path
+  uint64_t change_time_ns; // Last close-after-write/rename onto the file (0 = nothing pending)
+  off_t change_size;       // File size at change_time_ns
+#endif
 };
 
-PlatformPlugin *Platform_PluginLoad(const char *path) {
-  Arena *root = Platform_GetRootArena();
+#ifdef __linux__
+// Watch the directory rather than the file: the linker may replace the file (rename onto it),
+// which would silently end a watch on the old inode
+static void plugin_watch_start(PlatformPlugin *plugin) {
+  plugin->watch_fd = -1;
+  plugin->change_time_ns = 0;
+  plugin->change_size = 0;
+
+  char dir[256];
+  const char *slash = strrchr(plugin->path, '/');
+  if (slash) {
+    size_t len = (size_t)(slash - plugin->path);
+    if (len == 0) {
+      len = 1; // File in "/"
+    }
+    memcpy(dir, plugin->path, len);
+    dir[len] = '\0';
+    plugin->file_name = slash + 1;
+  } else {
+    strcpy(dir, ".");
+    plugin->file_name = plugin->path;
+  }
+
+  int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd < 0) {
+    Platform_LogWarning("inotify unavailable (%s), polling plugin file time instead", strerror(errno));
+    return;
+  }
+
+  if (inotify_add_watch(fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+    Platform_LogWarning("Can't watch '%s' (%s), polling plugin file time instead", dir, strerror(errno));
+    close(fd);
+    return;
+  }
+
+  plugin->watch_fd = fd;
+}
+
+static void plugin_watch_stop(PlatformPlugin *plugin) {
+  if (plugin->watch_fd >= 0) {
+    close(plugin->watch_fd);
+    plugin->watch_fd = -1;
+  }
+}
+
+static void plugin_watch_note_change(PlatformPlugin *plugin) {
+  struct stat st;
+  plugin->change_time_ns = Platform_GetTicksNS();
+  plugin->change_size = stat(plugin->path, &st) == 0 ? st.st_size : -1;
+}
+
+// Drain queued events (one read() returning EAGAIN when nothing happened), then report the
+// change once the file has been quiet for the debounce window
+static bool plugin_watch_poll(PlatformPlugin *plugin) {
+  char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+  for (;;) {
+    ssize_t len = read(plugin->watch_fd, buffer, sizeof(buffer));
+    if (len <= 0) {
+      break;
+    }
+
+    for (char *cursor = buffer; cursor < buffer + len;) {
+      const struct inotify_event *event = (const struct inotify_event *)cursor;
+      // Temp copies live in the same directory, so filter on the exact name. On queue
+      // overflow we can't tell which file changed: assume ours did.
+      if ((event->mask & IN_Q_OVERFLOW) ||
+          (event->len && strcmp(event->name, plugin->file_name) == 0)) {
+        plugin_watch_note_change(plugin);
+      }
+      cursor += sizeof(struct inotify_event) + event->len;
+    }
+  }
+
+  if (plugin->change_time_ns == 0 ||
+      Platform_GetTicksNS() - plugin->change_time_ns < PLUGIN_RELOAD_DEBOUNCE_NS) {
+    return false;
+  }
+
+  // Still being written (or gone mid-rebuild): restart the window rather than load it
+  struct stat st;
+  if (stat(plugin->path, &st) != 0 || st.st_size == 0 || st.st_size != plugin->change_size) {
+    plugin_watch_note_change(plugin);
+    return false;
+  }
+
+  plugin->change_time_ns = 0;
+  return true;
+}
+#endif
+
+static double ns_to_ms(uint64_t ns) {
+  return (double)ns / 1000000.0;
+}
+
+// ============================================================================
+// Plugin Images
+// ============================================================================
+static void plugin_image_clear(PluginImage *image) {
+  image->handle = NULL;
+  image->fd = -1;
+  image->temp_path[0] = '\0';
+}
+
+// Copy everything from src into dst (both already open), in-process
+static bool copy_fd(int src, int dst, off_t size) {
+  off_t offset = 0;
+#ifdef __linux__
+  // Kernel-side copy, no trip through user space
+  while (offset < size) {
+    ssize_t copied = sendfile(dst, src, &offset, (size_t)(size - offset));
+    if (copied <= 0) {
+      if (copied < 0 && errno == EINTR)
+        continue;
+      break; // Unsupported here (or failed): finish with plain reads/writes
+    }
+  }
+  if (offset >= size)
+    return true;
+  if (lseek(src, offset, SEEK_SET) < 0 || lseek(dst, offset, SEEK_SET) < 0)
+    return false;
+#endif
+
+  char buffer[65536];
+  while (offset < size) {
+    ssize_t bytes = read(src, buffer, sizeof(buffer));
+    if (bytes < 0 && errno == EINTR)
+      continue;
+    if (bytes <= 0)
+      return false;
+
+    for (ssize_t written = 0; written < bytes;) {
+      ssize_t result = write(dst, buffer + written, (size_t)(bytes - written));
+      if (result < 0 && errno == EINTR)
+        continue;
+      if (result <= 0)
+        return false;
+      written += result;
+    }
+    offset += bytes;
+  }
+  return true;
+}
+
+// Copy the plugin file into a fresh image (not yet loaded)
+static bool plugin_image_copy(PlatformPlugin *plugin, PluginImage *image) {
+  plugin_image_clear(image);
+
+  int src = open(plugin->path, O_RDONLY | O_CLOEXEC);
+  if (src < 0) {
+    Platform_LogError("Failed to open plugin: %s - %s", plugin->path, strerror(errno));
+    return false;
+  }
+
+  struct stat st;
+  if (fstat(src, &st) != 0) {
+    Platform_LogError("Failed to stat plugin: %s - %s", plugin->path, strerror(errno));
+    close(src);
+    return false;
+  }
+
+  int dst = -1;
+#ifdef __linux__
+  // Anonymous in-memory file: nothing is written to (or left behind on) disk
+  dst = memfd_create("flight_plugin", MFD_CLOEXEC);
+  if (dst >= 0) {
+    image->fd = dst;
+  }
+#endif
+
+  if (dst < 0) {
+    snprintf(image->temp_path, sizeof(image->temp_path), "%s.%ld.%u.tmp",
+             plugin->path, (long)getpid(), plugin->copy_count++);
+    dst = open(image->temp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0755);
+    if (dst < 0) {
+      Platform_LogError("Failed to create plugin copy: %s - %s", image->temp_path, strerror(errno));
+      image->temp_path[0] = '\0';
+      close(src);
+      return false;
+    }
+  }
+
+  bool ok = copy_fd(src, dst, st.st_size);
+  close(src);
+
+  if (image->fd < 0) {
+    // The on-disk copy is reopened by path; the memfd stays open until the image is released
+    if (close(dst) != 0) {
+      ok = false;
+    }
+  }
+
+  if (!ok) {
+    Platform_LogError("Failed to copy plugin: %s - %s", plugin->path, strerror(errno));
+    if (image->fd >= 0) {
+      close(image->fd);
+      image->fd = -1;
+    } else {
+      unlink(image->temp_path);
+      image->temp_path[0] = '\0';
+    }
+    return false;
+  }
+
+  return true;
+}
+
+static bool plugin_image_open(PluginImage *image) {
+  char fd_path[64];
+  const char *load_path = image->temp_path;
+  if (image->fd >= 0) {
+    snprintf(fd_path, sizeof(fd_path), "/proc/self/fd/%d", image->fd);
+    load_path = fd_path;
+  }
+
+  image->handle = dlopen(load_path, RTLD_NOW | RTLD_LOCAL);
+  if (!image->handle) {
+    Platform_LogError("Failed to load plugin: %s - %s", load_path, dlerror());
+    return false;
+  }
+  return true;
+}
+
+// dlclose (if loaded) and drop the backing copy
+static void plugin_image_release(PluginImage *image) {
+  if (image->handle) {
+    dlclose(image->handle);
+    image->handle = NULL;
+  }
+
+  if (image->fd >= 0) {
+    close(image->fd);
+    image->fd = -1;
+  }
+
+  if (image->temp_path[0]) {
+    unlink(image->temp_path);
+    image->temp_path[0] = '\0';
+  }
+}
+
+static void plugin_update_mtime(PlatformPlugin *plugin) {
+  struct stat st;
+  if (stat(plugin->path, &st) == 0) {
+    plugin->last_mtime = st.st_mtime;
+  }
+}
+
+// ============================================================================
+// Reload Thread
+// ============================================================================
+static void *plugin_reload_thread(void *arg) {
+  PlatformPlugin *plugin = arg;
+
+  // Nobody can revert to the build before the last swap any more: unload it here, off the main thread
+  plugin_image_release(&plugin->retired);
+
+  uint64_t start = Platform_GetTicksNS();
+  bool ok = plugin_image_copy(plugin, &plugin->staged);
+  uint64_t copied = Platform_GetTicksNS();
+
+  // Loads alongside the running build: RTLD_LOCAL and a distinct path keep the two apart
+  ok = ok && plugin_image_open(&plugin->staged);
+  uint64_t opened = Platform_GetTicksNS();
+
+  if (ok) {
+    Platform_Log("Plugin staged: %s (copy %.2f ms, dlopen %.2f ms, off the main thread)",
+                 plugin->path, ns_to_ms(copied - start), ns_to_ms(opened - copied));
+  } else {
+    plugin_image_release(&plugin->staged);
+  }
+
+  Platform_AtomicStoreSize(&plugin->reload_status,
+                           ok ? PLATFORM_PLUGIN_RELOAD_READY : PLATFORM_PLUGIN_RELOAD_FAILED);
+  return NULL;
+}
+
+static void plugin_reload_join(PlatformPlugin *plugin) {
+  if (plugin->reload_thread_running) {
+    pthread_join(plugin->reload_thread, NULL);
+    plugin->reload_thread_running = false;
+  }
+}
+
+// ============================================================================
+// Plugin API
+// ============================================================================
+size_t Platform_PluginRecordSize(void) {
+  return sizeof(PlatformPlugin);
+}
+
+const char *Platform_PluginGetPath(const PlatformPlugin *plugin) {
+  return plugin ? plugin->path : "";
+}
+
+// Hand the record back to the arena it came from (root allocations can't be freed)
+static void plugin_record_free(PlatformPlugin *plugin) {
+  if (plugin->arena) {
+    Arena_Free(plugin->arena, plugin);
+  }
+}
 
-  // NOTE: Allocated from root arena. Currently no free-list, so this
-  // memory isn't reclaimed on unload (~256 bytes per plugin).
-  // TODO: Implement free-list for Virtual arena to reclaim this.
-  PlatformPlugin *plugin = Arena_AllocType(root, PlatformPlugin);
+PlatformPlugin *Platform_PluginLoad(const char *path, Arena *arena) {
+  PlatformPlugin *plugin = Arena_AllocType(arena ? arena : Platform_GetRootArena(), PlatformPlugin);
   if (!plugin) {
     Platform_LogError("Failed to allocate plugin structure");
     return NULL;
   }
 
+  plugin->arena = arena;
+
   strncpy(plugin->path, path, sizeof(plugin->path) - 1);
   plugin->path[sizeof(plugin->path) - 1] = '\0';
-
-  // Create temp copy path
-  snprintf(plugin->temp_path, sizeof(plugin->temp_path),
-           "%s.%ld.tmp", path, (long)time(NULL));
-
-  // Copy plugin to temp location
-  char cmd[512];
-  snprintf(cmd, sizeof(cmd), "cp '%s' '%s'", path, plugin->temp_path);
-  if (system(cmd) != 0) {
-    Platform_LogError("Failed to copy plugin: %s", path);
-    // TODO: (ARC) Properly free the plugin* from the arena when Root has free-list capability.
+  plugin->copy_count = 0;
+  plugin_image_clear(&plugin->staged);
+  plugin_image_clear(&plugin->retired);
+  plugin->reload_thread_running = false;
+  plugin->reload_status = PLATFORM_PLUGIN_RELOAD_IDLE;
+
+  // Load a copy so the original can be rebuilt
+  uint64_t start = Platform_GetTicksNS();
+  if (!plugin_image_copy(plugin, &plugin->image)) {
+    plugin_record_free(plugin);
     return NULL;
   }
 
-  // Load the temp copy
-  plugin->handle = dlopen(plugin->temp_path, RTLD_NOW | RTLD_LOCAL);
-  if (!plugin->handle) {
-    Platform_LogError("Failed to load plugin: %s - %s", plugin->temp_path, dlerror());
-    unlink(plugin->temp_path);
-    // TODO: (ARC) Properly free the plugin* from the arena when Root has free-list capability.
+  uint64_t copied = Platform_GetTicksNS();
+  if (!plugin_image_open(&plugin->image)) {
+    plugin_image_release(&plugin->image);
+    plugin_record_free(plugin);
     return NULL;
   }
+  uint64_t opened = Platform_GetTicksNS();
 
   // Store file time for reload checking
-  struct stat st;
-  if (stat(path, &st) == 0) {
-    plugin->last_mtime = st.st_mtime;
-  }
+  plugin_update_mtime(plugin);
+
+#ifdef __linux__
+  plugin_watch_start(plugin);
+#endif
 
-  Platform_Log("Loaded plugin from: %s", path);
+  Platform_Log("Loaded plugin from: %s (copy %.2f ms, dlopen %.2f ms)",
+               path, ns_to_ms(copied - start), ns_to_ms(opened - copied));
   return plugin;
 }
 
@@ -69,19 +417,21 @@ void Platform_PluginUnload(PlatformPlugin *plugin) {
   if (!plugin)
     return;
 
-  if (plugin->handle) {
-    dlclose(plugin->handle);
-    plugin->handle = NULL;
-  }
+  // Let an in-flight reload finish so nothing is left loaded behind our back
+  plugin_reload_join(plugin);
+  plugin_image_release(&plugin->staged);
+  plugin_image_release(&plugin->retired);
+  plugin_image_release(&plugin->image);
 
-  // Delete temp file
-  unlink(plugin->temp_path);
+#ifdef __linux__
+  plugin_watch_stop(plugin);
+#endif
 
-  // TODO: (ARC) Properly free the plugin* from the arena when Root has free-list capability.
+  plugin_record_free(plugin);
 }
 
 void *Platform_PluginGetSymbol(PlatformPlugin *plugin, const char *name) {
-  if (!plugin || !plugin->handle) {
+  if (!plugin || !plugin->image.handle) {
     Platform_LogError("Invalid plugin handle");
     return NULL;
   }
@@ -89,7 +439,7 @@ void *Platform_PluginGetSymbol(PlatformPlugin *plugin, const char *name) {
   // Clear any existing error
   dlerror();
 
-  void *symbol = dlsym(plugin->handle, name);
+  void *symbol = dlsym(plugin->image.handle, name);
 
   const char *error = dlerror();
   if (error) {
@@ -104,6 +454,12 @@ bool Platform_PluginNeedsReload(PlatformPlugin *plugin) {
   if (!plugin)
     return false;
 
+#ifdef __linux__
+  if (plugin->watch_fd >= 0) {
+    return plugin_watch_poll(plugin);
+  }
+#endif
+
   struct stat st;
   if (stat(plugin->path, &st) != 0) {
     return false;
@@ -113,65 +469,76 @@ bool Platform_PluginNeedsReload(PlatformPlugin *plugin) {
   return st.st_mtime > plugin->last_mtime;
 }
 
-bool Platform_PluginReload(PlatformPlugin *plugin) {
-  if (!plugin)
+bool Platform_PluginBeginReload(PlatformPlugin *plugin) {
+  if (!plugin || Platform_AtomicLoadSize(&plugin->reload_status) != PLATFORM_PLUGIN_RELOAD_IDLE)
     return false;
 
   Platform_Log("Reloading plugin: %s", plugin->path);
 
-  // Save the old temp path
-  char old_temp_path[256];
-  strncpy(old_temp_path, plugin->temp_path, sizeof(old_temp_path) - 1);
-  old_temp_path[sizeof(old_temp_path) - 1] = '\0';
+  // Take the new file time now: a failed build isn't retried until the file changes again
+  plugin_update_mtime(plugin);
 
-  // Unload old handle
-  if (plugin->handle) {
-    dlclose(plugin->handle);
-    plugin->handle = NULL;
+  plugin->reload_status = PLATFORM_PLUGIN_RELOAD_LOADING;
+  if (pthread_create(&plugin->reload_thread, NULL, plugin_reload_thread, plugin) != 0) {
+    Platform_LogError("Failed to start plugin reload thread: %s", plugin->path);
+    plugin->reload_status = PLATFORM_PLUGIN_RELOAD_IDLE;
+    return false;
   }
 
-  // Sleep to let OS release file handles
-  usleep(50000); // 50ms in microseconds
+  plugin->reload_thread_running = true;
+  return true;
+}
+
+PlatformPluginReloadStatus Platform_PluginGetReloadStatus(PlatformPlugin *plugin) {
+  if (!plugin)
+    return PLATFORM_PLUGIN_RELOAD_IDLE;
+
+  PlatformPluginReloadStatus status =
+      (PlatformPluginReloadStatus)Platform_AtomicLoadSize(&plugin->reload_status);
+  if (status == PLATFORM_PLUGIN_RELOAD_FAILED) {
+    // The thread is already done, so this doesn't wait
+    plugin_reload_join(plugin);
+    plugin->reload_status = PLATFORM_PLUGIN_RELOAD_IDLE;
+  }
+  return status;
+}
 
-  // Create new temp path
-  snprintf(plugin->temp_path, sizeof(plugin->temp_path),
-           "%s.%ld.tmp", plugin->path, (long)time(NULL));
+bool Platform_PluginSwapReload(PlatformPlugin *plugin) {
+  if (!plugin || Platform_AtomicLoadSize(&plugin->reload_status) != PLATFORM_PLUGIN_RELOAD_READY)
+    return false;
 
-  // Copy new version to temp
-  char cmd[1024];
-  snprintf(cmd, sizeof(cmd), "cp '%s' '%s'", plugin->path, plugin->temp_path);
-  if (system(cmd) != 0) {
-    Platform_LogError("Failed to copy plugin during reload: %s", plugin->path);
+  plugin_reload_join(plugin);
 
-    // Try to reload the old temp file as fallback
-    Platform_Log("Attempting to reload old version...");
-    plugin->handle = dlopen(old_temp_path, RTLD_NOW | RTLD_LOCAL);
-    if (plugin->handle) {
-      strncpy(plugin->temp_path, old_temp_path, sizeof(plugin->temp_path) - 1);
-      Platform_LogWarning("Reloaded old version successfully");
-      return false;
-    }
+  plugin->retired = plugin->image;
+  plugin->image = plugin->staged;
+  plugin_image_clear(&plugin->staged);
+  plugin->reload_status = PLATFORM_PLUGIN_RELOAD_IDLE;
+  return true;
+}
 
-    return false;
-  }
+void Platform_PluginRevertReload(PlatformPlugin *plugin) {
+  if (!plugin || !plugin->retired.handle)
+    return;
 
-  // Delete old temp file now that we have a new one
-  unlink(old_temp_path);
+  Platform_LogWarning("Reverting plugin to its previous build: %s", plugin->path);
+  plugin_image_release(&plugin->image);
+  plugin->image = plugin->retired;
+  plugin_image_clear(&plugin->retired);
+}
 
-  // Load new version
-  plugin->handle = dlopen(plugin->temp_path, RTLD_NOW | RTLD_LOCAL);
-  if (!plugin->handle) {
-    Platform_LogError("Failed to load plugin during reload: %s - %s",
-                      plugin->temp_path, dlerror());
+bool Platform_PluginReload(PlatformPlugin *plugin) {
+  if (!Platform_PluginBeginReload(plugin))
     return false;
-  }
 
-  // Update file time
-  struct stat st;
-  if (stat(plugin->path, &st) == 0) {
-    plugin->last_mtime = st.st_mtime;
+  // Same staging as the async path, just waited on
+  plugin_reload_join(plugin);
+  if (!Platform_PluginSwapReload(plugin)) {
+    Platform_LogError("Failed to reload plugin: %s", plugin->path);
+    Platform_PluginGetReloadStatus(plugin); // Consume the failure
+    return false;
   }
 
-  Platform_Log("Plugin reloaded successfully: %s", plugin->temp_path);
+  plugin_image_release(&plugin->retired);
+  Platform_Log("Plugin reloaded: %s", plugin->path);
   return true;
-}
\ No newline at end of file
+}
@@ -1,4 +1,5 @@
 #include "platform.h"
+#include "platform_atomic.h"
 #include "platform_plugin.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -6,56 +7,203 @@
 #include <time.h>
 #include <windows.h>
 
-struct PlatformPlugin {
+// One loaded copy of the plugin (DLL + PDB copied next to the original, so it can be rebuilt)
+typedef struct PluginImage {
   HMODULE dll;
-  char path[MAX_PATH];
   char temp_path[MAX_PATH];
+} PluginImage;
+
+struct PlatformPlugin {
+  Arena *arena; // Record owner (NULL = root arena, never freed)
+  PluginImage image;   // Current build: what symbols resolve against
+  PluginImage staged;  // Loaded by the reload thread, waiting to be swapped in
+  PluginImage retired; // Build before the last swap, kept for Platform_PluginRevertReload
+  char path[MAX_PATH];
+  uint32_t copy_count; // Keeps temp copy names unique within a process
   FILETIME last_write_time;
+
+  // Async reload: the thread owns staged/retired/copy_count while status is LOADING
+  HANDLE reload_thread;          // NULL once joined
+  volatile size_t reload_status; // PlatformPluginReloadStatus
 };
 
-PlatformPlugin *Platform_PluginLoad(const char *path) {
-  Arena *root = Platform_GetRootArena();
+static double ns_to_ms(uint64_t ns) {
+  return (double)ns / 1000000.0;
+}
+
+// ============================================================================
+// Plugin Images
+// ============================================================================
+static void plugin_image_clear(PluginImage *image) {
+  image->dll = NULL;
+  image->temp_path[0] = '\0';
+}
+
+// Copy the DLL (and PDB, if there is one) to a fresh temp name
+static bool plugin_image_copy(PlatformPlugin *plugin, PluginImage *image) {
+  plugin_image_clear(image);
+  snprintf(image->temp_path, MAX_PATH, "%s.%lu.%u.tmp",
+           plugin->path, (unsigned long)GetCurrentProcessId(), plugin->copy_count++);
+
+  // Copy DLL
+  if (!CopyFileA(plugin->path, image->temp_path, FALSE)) {
+    Platform_LogError("Failed to copy plugin: %s (error: %lu)", plugin->path, GetLastError());
+    image->temp_path[0] = '\0';
+    return false;
+  }
+
+  // Also copy PDB if it exists
+  char pdb_source[MAX_PATH];
+  char pdb_dest[MAX_PATH];
+
+  // Build PDB paths (replace .dll with .pdb)
+  strncpy(pdb_source, plugin->path, MAX_PATH - 1);
+  pdb_source[MAX_PATH - 1] = '\0';
+  char *ext = strrchr(pdb_source, '.');
+  if (ext) {
+    strcpy(ext, ".pdb");
+
+    snprintf(pdb_dest, MAX_PATH, "%s.pdb", image->temp_path);
 
-  // NOTE: Allocated from root arena. Currently no free-list, so this
-  // memory isn't reclaimed on unload (~256 bytes per plugin).
-  // TODO: Implement free-list for Virtual arena to reclaim this.
-  PlatformPlugin *plugin = Arena_AllocType(root, PlatformPlugin);
+    // Try to copy PDB (non-fatal if it fails)
+    if (CopyFileA(pdb_source, pdb_dest, FALSE)) {
+      Platform_Log("Copied PDB: %s", pdb_dest);
+    } else {
+      Platform_LogWarning("Failed to copy PDB (non-fatal): %s", pdb_source);
+    }
+  }
+
+  return true;
+}
+
+static bool plugin_image_open(PluginImage *image) {
+  image->dll = LoadLibraryA(image->temp_path);
+  if (!image->dll) {
+    Platform_LogError("Failed to load plugin: %s (error: %lu)", image->temp_path, GetLastError());
+    return false;
+  }
+  return true;
+}
+
+// FreeLibrary (if loaded) and delete the temp copies
+static void plugin_image_release(PluginImage *image) {
+  if (image->dll) {
+    FreeLibrary(image->dll);
+    image->dll = NULL;
+  }
+
+  if (image->temp_path[0]) {
+    DeleteFileA(image->temp_path);
+
+    char pdb[MAX_PATH];
+    snprintf(pdb, MAX_PATH, "%s.pdb", image->temp_path);
+    DeleteFileA(pdb);
+
+    image->temp_path[0] = '\0';
+  }
+}
+
+static void plugin_update_write_time(PlatformPlugin *plugin) {
+  HANDLE file = CreateFileA(plugin->path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                            NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file != INVALID_HANDLE_VALUE) {
+    GetFileTime(file, NULL, NULL, &plugin->last_write_time);
+    CloseHandle(file);
+  }
+}
+
+// ============================================================================
+// Reload Thread
+// ============================================================================
+static DWORD WINAPI plugin_reload_thread(LPVOID arg) {
+  PlatformPlugin *plugin = arg;
+
+  // Nobody can revert to the build before the last swap any more: unload it here, off the main thread
+  plugin_image_release(&plugin->retired);
+
+  uint64_t start = Platform_GetTicksNS();
+  bool ok = plugin_image_copy(plugin, &plugin->staged);
+  uint64_t copied = Platform_GetTicksNS();
+
+  // Loads alongside the running build (different file name, so a different module)
+  ok = ok && plugin_image_open(&plugin->staged);
+  uint64_t opened = Platform_GetTicksNS();
+
+  if (ok) {
+    Platform_Log("Plugin staged: %s (copy %.2f ms, LoadLibrary %.2f ms, off the main thread)",
+                 plugin->path, ns_to_ms(copied - start), ns_to_ms(opened - copied));
+  } else {
+    plugin_image_release(&plugin->staged);
+  }
+
+  Platform_AtomicStoreSize(&plugin->reload_status,
+                           ok ? PLATFORM_PLUGIN_RELOAD_READY : PLATFORM_PLUGIN_RELOAD_FAILED);
+  return 0;
+}
+
+static void plugin_reload_join(PlatformPlugin *plugin) {
+  if (plugin->reload_thread) {
+    WaitForSingleObject(plugin->reload_thread, INFINITE);
+    CloseHandle(plugin->reload_thread);
+    plugin->reload_thread = NULL;
+  }
+}
+
+// ============================================================================
+// Plugin API
+// ============================================================================
+size_t Platform_PluginRecordSize(void) {
+  return sizeof(PlatformPlugin);
+}
+
+const char *Platform_PluginGetPath(const PlatformPlugin *plugin) {
+  return plugin ? plugin->path : "";
+}
+
+// Hand the record back to the arena it came from (root allocations can't be freed)
+static void plugin_record_free(PlatformPlugin *plugin) {
+  if (plugin->arena) {
+    Arena_Free(plugin->arena, plugin);
+  }
+}
+
+PlatformPlugin *Platform_PluginLoad(const char *path, Arena *arena) {
+  PlatformPlugin *plugin = Arena_AllocType(arena ? arena : Platform_GetRootArena(), PlatformPlugin);
   if (!plugin) {
     Platform_LogError("Failed to allocate plugin structure");
     return NULL;
   }
 
+  plugin->arena = arena;
+
   strncpy(plugin->path, path, MAX_PATH - 1);
   plugin->path[MAX_PATH - 1] = '\0';
-
-  // Create temp copy path (so original can be rebuilt)
-  snprintf(plugin->temp_path, MAX_PATH, "%s.%llu.tmp", path, (unsigned long long)time(NULL));
-
-  // Copy DLL to temp location
-  if (!CopyFileA(path, plugin->temp_path, FALSE)) {
-    Platform_LogError("Failed to copy plugin: %s", path);
-    // TODO: (ARC) Properly free the plugin* from the arena when Root has free-list capability.
+  plugin->copy_count = 0;
+  plugin_image_clear(&plugin->staged);
+  plugin_image_clear(&plugin->retired);
+  plugin->reload_thread = NULL;
+  plugin->reload_status = PLATFORM_PLUGIN_RELOAD_IDLE;
+
+  // Load a temp copy (so original can be rebuilt)
+  uint64_t start = Platform_GetTicksNS();
+  if (!plugin_image_copy(plugin, &plugin->image)) {
+    plugin_record_free(plugin);
     return NULL;
   }
 
-  // Load the temp copy
-  plugin->dll = LoadLibraryA(plugin->temp_path);
-  if (!plugin->dll) {
-    Platform_LogError("Failed to load plugin: %s (error: %lu)", plugin->temp_path, GetLastError());
-    DeleteFileA(plugin->temp_path);
-    // TODO: (ARC) Properly free the plugin* from the arena when Root has free-list capability.
+  uint64_t copied = Platform_GetTicksNS();
+  if (!plugin_image_open(&plugin->image)) {
+    plugin_image_release(&plugin->image);
+    plugin_record_free(plugin);
     return NULL;
   }
+  uint64_t opened = Platform_GetTicksNS();
 
   // Store file time for reload checking
-  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
-                            NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
-  if (file != INVALID_HANDLE_VALUE) {
-    GetFileTime(file, NULL, NULL, &plugin->last_write_time);
-    CloseHandle(file);
-  }
+  plugin_update_write_time(plugin);
 
-  Platform_Log("Loaded plugin from: %s", path);
+  Platform_Log("Loaded plugin from: %s (copy %.2f ms, LoadLibrary %.2f ms)",
+               path, ns_to_ms(copied - start), ns_to_ms(opened - copied));
   return plugin;
 }
 
@@ -63,24 +211,22 @@ void Platform_PluginUnload(PlatformPlugin *plugin) {
   if (!plugin)
     return;
 
-  if (plugin->dll) {
-    FreeLibrary(plugin->dll);
-    plugin->dll = NULL;
-  }
-
-  // Delete temp file
-  DeleteFileA(plugin->temp_path);
+  // Let an in-flight reload finish so nothing is left loaded behind our back
+  plugin_reload_join(plugin);
+  plugin_image_release(&plugin->staged);
+  plugin_image_release(&plugin->retired);
+  plugin_image_release(&plugin->image);
 
-    // TODO: (ARC) Properly free the plugin* from the arena when Root has free-list capability.
+  plugin_record_free(plugin);
 }
 
 void *Platform_PluginGetSymbol(PlatformPlugin *plugin, const char *name) {
-  if (!plugin || !plugin->dll) {
+  if (!plugin || !plugin->image.dll) {
     Platform_LogError("Invalid plugin handle");
     return NULL;
   }
 
-  void *symbol = (void *)GetProcAddress(plugin->dll, name);
+  void *symbol = (void *)GetProcAddress(plugin->image.dll, name);
   if (!symbol) {
     Platform_LogError("Symbol not found: %s", name);
   }
@@ -106,89 +252,79 @@ bool Platform_PluginNeedsReload(PlatformPlugin *plugin) {
   return CompareFileTime(&current_time, &plugin->last_write_time) != 0;
 }
 
-bool Platform_PluginReload(PlatformPlugin *plugin) {
-  if (!plugin)
+// ============================================================================
+// Reload
+// ============================================================================
+bool Platform_PluginBeginReload(PlatformPlugin *plugin) {
+  if (!plugin || Platform_AtomicLoadSize(&plugin->reload_status) != PLATFORM_PLUGIN_RELOAD_IDLE)
     return false;
 
   Platform_Log("Reloading plugin: %s", plugin->path);
 
-  // Save the old temp path
-  char old_temp_path[MAX_PATH];
-  strncpy(old_temp_path, plugin->temp_path, MAX_PATH - 1);
+  // Take the new write time now: a failed build isn't retried until the file changes again
+  plugin_update_write_time(plugin);
 
-  // Unload old DLL
-  if (plugin->dll) {
-    FreeLibrary(plugin->dll);
-    plugin->dll = NULL;
+  plugin->reload_status = PLATFORM_PLUGIN_RELOAD_LOADING;
+  plugin->reload_thread = CreateThread(NULL, 0, plugin_reload_thread, plugin, 0, NULL);
+  if (!plugin->reload_thread) {
+    Platform_LogError("Failed to start plugin reload thread: %s (error: %lu)", plugin->path, GetLastError());
+    plugin->reload_status = PLATFORM_PLUGIN_RELOAD_IDLE;
+    return false;
   }
 
-  // Sleep to let Windows release file handles
-  Sleep(50);
-
-  // Create new temp path
-  snprintf(plugin->temp_path, MAX_PATH, "%s.%llu.tmp",
-           plugin->path, (unsigned long long)time(NULL));
+  return true;
+}
 
-  // Copy DLL
-  if (!CopyFileA(plugin->path, plugin->temp_path, FALSE)) {
-    DWORD error = GetLastError();
-    Platform_LogError("Failed to copy plugin during reload: %s (error: %lu)",
-                      plugin->path, error);
-
-    // Fallback to old version
-    plugin->dll = LoadLibraryA(old_temp_path);
-    if (plugin->dll) {
-      strncpy(plugin->temp_path, old_temp_path, MAX_PATH - 1);
-      Platform_LogWarning("Reloaded old version successfully");
-      return false;
-    }
-    return false;
+PlatformPluginReloadStatus Platform_PluginGetReloadStatus(PlatformPlugin *plugin) {
+  if (!plugin)
+    return PLATFORM_PLUGIN_RELOAD_IDLE;
+
+  PlatformPluginReloadStatus status =
+      (PlatformPluginReloadStatus)Platform_AtomicLoadSize(&plugin->reload_status);
+  if (status == PLATFORM_PLUGIN_RELOAD_FAILED) {
+    // The thread is already done, so this doesn't wait
+    plugin_reload_join(plugin);
+    plugin->reload_status = PLATFORM_PLUGIN_RELOAD_IDLE;
   }
+  return status;
+}
 
-  // Also copy PDB if it exists
-  char pdb_source[MAX_PATH];
-  char pdb_dest[MAX_PATH];
-
-  // Build PDB paths (replace .dll with .pdb)
-  strncpy(pdb_source, plugin->path, MAX_PATH - 1);
-  char *ext = strrchr(pdb_source, '.');
-  if (ext) {
-    strcpy(ext, ".pdb");
+bool Platform_PluginSwapReload(PlatformPlugin *plugin) {
+  if (!plugin || Platform_AtomicLoadSize(&plugin->reload_status) != PLATFORM_PLUGIN_RELOAD_READY)
+    return false;
 
-    snprintf(pdb_dest, MAX_PATH, "%s.pdb", plugin->temp_path);
+  plugin_reload_join(plugin);
 
-    // Try to copy PDB (non-fatal if it fails)
-    if (CopyFileA(pdb_source, pdb_dest, FALSE)) {
-      Platform_Log("Copied PDB: %s", pdb_dest);
-    } else {
-      Platform_LogWarning("Failed to copy PDB (non-fatal): %s", pdb_source);
-    }
-  }
+  plugin->retired = plugin->image;
+  plugin->image = plugin->staged;
+  plugin_image_clear(&plugin->staged);
+  plugin->reload_status = PLATFORM_PLUGIN_RELOAD_IDLE;
+  return true;
+}
 
-  // Delete old temp files
-  DeleteFileA(old_temp_path);
+void Platform_PluginRevertReload(PlatformPlugin *plugin) {
+  if (!plugin || !plugin->retired.dll)
+    return;
 
-  // Also delete old PDB
-  char old_pdb[MAX_PATH];
-  snprintf(old_pdb, MAX_PATH, "%s.pdb", old_temp_path);
-  DeleteFileA(old_pdb);
+  Platform_LogWarning("Reverting plugin to its previous build: %s", plugin->path);
+  plugin_image_release(&plugin->image);
+  plugin->image = plugin->retired;
+  plugin_image_clear(&plugin->retired);
+}
 
-  // Load new version
-  plugin->dll = LoadLibraryA(plugin->temp_path);
-  if (!plugin->dll) {
-    Platform_LogError("Failed to load plugin during reload: %s (error: %lu)",
-                      plugin->temp_path, GetLastError());
+bool Platform_PluginReload(PlatformPlugin *plugin) {
+  if (!Platform_PluginBeginReload(plugin))
     return false;
-  }
 
-  // Update file time
-  HANDLE file = CreateFileA(plugin->path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
-                            NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
-  if (file != INVALID_HANDLE_VALUE) {
-    GetFileTime(file, NULL, NULL, &plugin->last_write_time);
-    CloseHandle(file);
+  // Same staging as the async path, just waited on
+  plugin_reload_join(plugin);
+  if (!Platform_PluginSwapReload(plugin)) {
+    Platform_LogError("Failed to reload plugin: %s", plugin->path);
+    Platform_PluginGetReloadStatus(plugin); // Consume the failure
+    return false;
   }
 
-  Platform_Log("Plugin reloaded successfully: %s", plugin->temp_path);
+  plugin_image_release(&plugin->retired);
+  Platform_Log("Plugin reloaded successfully: %s", plugin->image.temp_path);
   return true;
-}
\ No newline at end of file
+}
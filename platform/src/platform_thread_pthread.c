@@ -0,0 +1,376 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#ifdef __linux__
+#define _GNU_SOURCE // pthread_setname_np, pthread_setaffinity_np, sched_getaffinity
+#endif
+
+#include "platform.h"
+#include "platform_thread.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#define THREAD_NAME_MAX 16 // Linux limit, including the terminator
+
+struct PlatformThread {
+  pthread_t thread;
+  PlatformThreadFunc func;
+  void *data;
+  int result;
+  char name[THREAD_NAME_MAX];
+};
+
+struct PlatformMutex {
+  pthread_mutex_t mutex;
+};
+
+struct PlatformCondition {
+  pthread_cond_t cond;
+};
+
+// Mutex + condition rather than sem_t: unnamed POSIX semaphores don't exist on macOS
+struct PlatformSemaphore {
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  uint32_t count;
+};
+
+// Condition variables time out against CLOCK_MONOTONIC where the OS allows choosing, so a wall
+// clock change can't stretch or cut a wait short
+#ifdef __APPLE__
+#define CONDITION_CLOCK CLOCK_REALTIME
+#else
+#define CONDITION_CLOCK CLOCK_MONOTONIC
+#endif
+
+static void condition_init(pthread_cond_t *cond) {
+#ifdef __APPLE__
+  pthread_cond_init(cond, NULL);
+#else
+  pthread_condattr_t attr;
+  pthread_condattr_init(&attr);
+  pthread_condattr_setclock(&attr, CONDITION_CLOCK);
+  pthread_cond_init(cond, &attr);
+  pthread_condattr_destroy(&attr);
+#endif
+}
+
+static struct timespec deadline_after(uint64_t timeout_ns) {
+  struct timespec deadline;
+  clock_gettime(CONDITION_CLOCK, &deadline);
+  uint64_t nsec = (uint64_t)deadline.tv_nsec + timeout_ns % 1000000000ull;
+  deadline.tv_sec += (time_t)(timeout_ns / 1000000000ull + nsec / 1000000000ull);
+  deadline.tv_nsec = (long)(nsec % 1000000000ull);
+  return deadline;
+}
+
+// ============================================================================
+// Threads
+// ============================================================================
+static void thread_set_current_name(const char *name) {
+#if defined(__APPLE__)
+  pthread_setname_np(name);
+#elif defined(__linux__)
+  pthread_setname_np(pthread_self(), name);
+#else
+  (void)name;
+#endif
+}
+
+static void *thread_main(void *arg) {
+  PlatformThread *thread = arg;
+  if (thread->name[0]) {
+    thread_set_current_name(thread->name);
+  }
+  thread->result = thread->func(thread->data);
+  return NULL;
+}
+
+PlatformThread *Platform_ThreadCreate(PlatformThreadFunc func, const char *name, void *data) {
+  PlatformThread *thread = calloc(1, sizeof(PlatformThread));
+  if (!thread)
+    return NULL;
+
+  thread->func = func;
+  thread->data = data;
+  if (name) {
+    strncpy(thread->name, name, THREAD_NAME_MAX - 1);
+  }
+
+  int error = pthread_create(&thread->thread, NULL, thread_main, thread);
+  if (error != 0) {
+    Platform_LogError("Failed to create thread '%s': %s", name ? name : "", strerror(error));
+    free(thread);
+    return NULL;
+  }
+  return thread;
+}
+
+int Platform_ThreadJoin(PlatformThread *thread) {
+  if (!thread)
+    return 0;
+
+  pthread_join(thread->thread, NULL);
+  int result = thread->result;
+  free(thread);
+  return result;
+}
+
+void Platform_ThreadSetName(const char *name) {
+  char truncated[THREAD_NAME_MAX];
+  strncpy(truncated, name, THREAD_NAME_MAX - 1);
+  truncated[THREAD_NAME_MAX - 1] = '\0';
+  thread_set_current_name(truncated);
+}
+
+bool Platform_ThreadSetAffinity(PlatformThread *thread, uint64_t cpu_mask) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu = 0; cpu < 64; ++cpu) {
+    if (cpu_mask & (1ull << cpu)) {
+      CPU_SET(cpu, &set);
+    }
+  }
+
+  int error = pthread_setaffinity_np(thread ? thread->thread : pthread_self(), sizeof(set), &set);
+  if (error != 0) {
+    Platform_LogWarning("Failed to set thread affinity 0x%llx: %s", (unsigned long long)cpu_mask, strerror(error));
+    return false;
+  }
+  return true;
+#else
+  // macOS only has affinity hints (thread_policy_set tags), not pinning
+  (void)thread;
+  (void)cpu_mask;
+  return false;
+#endif
+}
+
+void Platform_ThreadYield(void) {
+  sched_yield();
+}
+
+uint32_t Platform_GetCPUCount(void) {
+#ifdef __linux__
+  // The CPUs this process may actually run on (containers, taskset), not every CPU in the machine
+  cpu_set_t set;
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    int count = CPU_COUNT(&set);
+    if (count > 0)
+      return (uint32_t)count;
+  }
+#endif
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+  return count > 0 ? (uint32_t)count : 1;
+}
+
+// ============================================================================
+// Mutexes and condition variables
+// ============================================================================
+PlatformMutex *Platform_MutexCreate(void) {
+  PlatformMutex *mutex = calloc(1, sizeof(PlatformMutex));
+  if (!mutex)
+    return NULL;
+
+  pthread_mutex_init(&mutex->mutex, NULL);
+  return mutex;
+}
+
+void Platform_MutexDestroy(PlatformMutex *mutex) {
+  if (mutex) {
+    pthread_mutex_destroy(&mutex->mutex);
+    free(mutex);
+  }
+}
+
+void Platform_MutexLock(PlatformMutex *mutex) {
+  pthread_mutex_lock(&mutex->mutex);
+}
+
+bool Platform_MutexTryLock(PlatformMutex *mutex) {
+  return pthread_mutex_trylock(&mutex->mutex) == 0;
+}
+
+void Platform_MutexUnlock(PlatformMutex *mutex) {
+  pthread_mutex_unlock(&mutex->mutex);
+}
+
+PlatformCondition *Platform_ConditionCreate(void) {
+  PlatformCondition *condition = calloc(1, sizeof(PlatformCondition));
+  if (!condition)
+    return NULL;
+
+  condition_init(&condition->cond);
+  return condition;
+}
+
+void Platform_ConditionDestroy(PlatformCondition *condition) {
+  if (condition) {
+    pthread_cond_destroy(&condition->cond);
+    free(condition);
+  }
+}
+
+void Platform_ConditionWait(PlatformCondition *condition, PlatformMutex *mutex) {
+  pthread_cond_wait(&condition->cond, &mutex->mutex);
+}
+
+bool Platform_ConditionWaitTimeout(PlatformCondition *condition, PlatformMutex *mutex, uint64_t timeout_ns) {
+  if (timeout_ns == PLATFORM_WAIT_FOREVER) {
+    pthread_cond_wait(&condition->cond, &mutex->mutex);
+    return true;
+  }
+
+  struct timespec deadline = deadline_after(timeout_ns);
+  return pthread_cond_timedwait(&condition->cond, &mutex->mutex, &deadline) != ETIMEDOUT;
+}
+
+void Platform_ConditionSignal(PlatformCondition *condition) {
+  pthread_cond_signal(&condition->cond);
+}
+
+void Platform_ConditionBroadcast(PlatformCondition *condition) {
+  pthread_cond_broadcast(&condition->cond);
+}
+
+// ============================================================================
+// Semaphores
+// ============================================================================
+PlatformSemaphore *Platform_SemaphoreCreate(uint32_t initial_count) {
+  PlatformSemaphore *semaphore = calloc(1, sizeof(PlatformSemaphore));
+  if (!semaphore)
+    return NULL;
+
+  pthread_mutex_init(&semaphore->mutex, NULL);
+  condition_init(&semaphore->cond);
+  semaphore->count = initial_count;
+  return semaphore;
+}
+
+void Platform_SemaphoreDestroy(PlatformSemaphore *semaphore) {
+  if (semaphore) {
+    pthread_cond_destroy(&semaphore->cond);
+    pthread_mutex_destroy(&semaphore->mutex);
+    free(semaphore);
+  }
+}
+
+void Platform_SemaphoreWait(PlatformSemaphore *semaphore) {
+  pthread_mutex_lock(&semaphore->mutex);
+  while (semaphore->count == 0) {
+    pthread_cond_wait(&semaphore->cond, &semaphore->mutex);
+  }
+  semaphore->count--;
+  pthread_mutex_unlock(&semaphore->mutex);
+}
+
+bool Platform_SemaphoreTryWait(PlatformSemaphore *semaphore) {
+  pthread_mutex_lock(&semaphore->mutex);
+  bool acquired = semaphore->count > 0;
+  if (acquired) {
+    semaphore->count--;
+  }
+  pthread_mutex_unlock(&semaphore->mutex);
+  return acquired;
+}
+
+void Platform_SemaphorePost(PlatformSemaphore *semaphore, uint32_t count) {
+  if (count == 0)
+    return;
+
+  pthread_mutex_lock(&semaphore->mutex);
+  semaphore->count += count;
+  pthread_mutex_unlock(&semaphore->mutex);
+
+  if (count == 1) {
+    pthread_cond_signal(&semaphore->cond);
+  } else {
+    pthread_cond_broadcast(&semaphore->cond);
+  }
+}
+
+// ============================================================================
+// Address waits
+// ============================================================================
+#ifdef __linux__
+bool Platform_WaitOnAddress(volatile uint32_t *address, uint32_t expected, uint64_t timeout_ns) {
+  struct timespec timeout;
+  struct timespec *timeout_ptr = NULL;
+  if (timeout_ns != PLATFORM_WAIT_FOREVER) {
+    timeout.tv_sec = (time_t)(timeout_ns / 1000000000ull);
+    timeout.tv_nsec = (long)(timeout_ns % 1000000000ull);
+    timeout_ptr = &timeout;
+  }
+
+  // Returns at once (EAGAIN) if *address no longer holds expected
+  long result = syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, expected, timeout_ptr, NULL, 0);
+  return result == 0 || errno != ETIMEDOUT;
+}
+
+void Platform_WakeOnAddress(volatile uint32_t *address, bool wake_all) {
+  syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, wake_all ? INT32_MAX : 1, NULL, NULL, 0);
+}
+#else
+// No public futex: park waiters on one of a fixed set of mutex/condition buckets picked by address.
+// Unrelated addresses can share a bucket, so a wake broadcasts and waiters re-check their value.
+#define PARKING_BUCKET_COUNT 64
+
+typedef struct ParkingBucket {
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+} ParkingBucket;
+
+static ParkingBucket g_parking_buckets[PARKING_BUCKET_COUNT];
+static pthread_once_t g_parking_once = PTHREAD_ONCE_INIT;
+
+static void parking_init(void) {
+  for (int i = 0; i < PARKING_BUCKET_COUNT; ++i) {
+    pthread_mutex_init(&g_parking_buckets[i].mutex, NULL);
+    condition_init(&g_parking_buckets[i].cond);
+  }
+}
+
+static ParkingBucket *parking_bucket(volatile uint32_t *address) {
+  pthread_once(&g_parking_once, parking_init);
+  uintptr_t key = (uintptr_t)address >> 2;
+  return &g_parking_buckets[(key ^ (key >> 6)) % PARKING_BUCKET_COUNT];
+}
+
+bool Platform_WaitOnAddress(volatile uint32_t *address, uint32_t expected, uint64_t timeout_ns) {
+  ParkingBucket *bucket = parking_bucket(address);
+  bool woken = true;
+
+  pthread_mutex_lock(&bucket->mutex);
+  if (__atomic_load_n(address, __ATOMIC_ACQUIRE) == expected) {
+    if (timeout_ns == PLATFORM_WAIT_FOREVER) {
+      pthread_cond_wait(&bucket->cond, &bucket->mutex);
+    } else {
+      struct timespec deadline = deadline_after(timeout_ns);
+      woken = pthread_cond_timedwait(&bucket->cond, &bucket->mutex, &deadline) != ETIMEDOUT;
+    }
+  }
+  pthread_mutex_unlock(&bucket->mutex);
+  return woken;
+}
+
+void Platform_WakeOnAddress(volatile uint32_t *address, bool wake_all) {
+  (void)wake_all;
+  ParkingBucket *bucket = parking_bucket(address);
+
+  // Taking the lock orders the wake after any waiter's value check
+  pthread_mutex_lock(&bucket->mutex);
+  pthread_cond_broadcast(&bucket->cond);
+  pthread_mutex_unlock(&bucket->mutex);
+}
+#endif
@@ -0,0 +1,155 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#include "platform.h"
+#include "platform_atomic.h"
+#include "platform_frame_pacer.h"
+#include <math.h>
+#include <string.h>
+
+// How long before a deadline to stop sleeping and spin, until a pacer has learnt better.
+// Windows timers wake far later than Linux/macOS ones.
+#ifdef _WIN32
+#define SLEEP_SPIN_DEFAULT_NS 2000000ull
+#else
+#define SLEEP_SPIN_DEFAULT_NS 200000ull
+#endif
+#define SLEEP_SPIN_MIN_NS 20000.0
+#define SLEEP_SPIN_MAX_NS 4000000.0
+
+#define PACER_OVERSLEEP_WEIGHT 0.05 // Moving average weight of each new oversleep sample
+#define PACER_REPORT_INTERVAL_NS 5000000000ull
+
+static double ns_to_ms(double ns) {
+  return ns / 1000000.0;
+}
+
+// OS sleep until spin_ns before target, then spin. Returns how late the OS sleep woke up
+// (0 if there was no time left to sleep).
+static uint64_t sleep_until_hybrid(uint64_t target_ns, uint64_t spin_ns) {
+  uint64_t now = Platform_GetTicksNS();
+  uint64_t oversleep = 0;
+  if (target_ns > now + spin_ns) {
+    uint64_t wake = target_ns - spin_ns;
+    Platform_Sleep(wake - now);
+    now = Platform_GetTicksNS();
+    oversleep = now > wake ? now - wake : 0;
+  }
+
+  while (now < target_ns) {
+    Platform_CPURelax();
+    now = Platform_GetTicksNS();
+  }
+  return oversleep;
+}
+
+void Platform_SleepUntil(uint64_t target_ns) {
+  sleep_until_hybrid(target_ns, SLEEP_SPIN_DEFAULT_NS);
+}
+
+// ============================================================================
+// Frame Pacer
+// ============================================================================
+void Platform_FramePacerInit(PlatformFramePacer *pacer, uint32_t target_fps) {
+  memset(pacer, 0, sizeof(*pacer));
+  pacer->oversleep_ns = SLEEP_SPIN_DEFAULT_NS / 2.0;
+  pacer->oversleep_dev_ns = SLEEP_SPIN_DEFAULT_NS / 8.0;
+  pacer->report_interval_ns = PACER_REPORT_INTERVAL_NS;
+  Platform_FramePacerSetTargetFPS(pacer, target_fps);
+}
+
+void Platform_FramePacerSetTargetFPS(PlatformFramePacer *pacer, uint32_t target_fps) {
+  pacer->target_ns = target_fps ? 1000000000ull / target_fps : 0;
+  pacer->deadline_ns = 0; // Restart from the next frame
+  Platform_FramePacerResetStats(pacer);
+}
+
+// Sleep for what the OS is expected to hold to, spin the rest
+static uint64_t pacer_spin_window(const PlatformFramePacer *pacer) {
+  double window = pacer->oversleep_ns + 4.0 * pacer->oversleep_dev_ns;
+  if (window < SLEEP_SPIN_MIN_NS)
+    window = SLEEP_SPIN_MIN_NS;
+  if (window > SLEEP_SPIN_MAX_NS)
+    window = SLEEP_SPIN_MAX_NS;
+  return (uint64_t)window;
+}
+
+static void pacer_learn_oversleep(PlatformFramePacer *pacer, uint64_t oversleep) {
+  double error = (double)oversleep - pacer->oversleep_ns;
+  pacer->oversleep_ns += PACER_OVERSLEEP_WEIGHT * error;
+  pacer->oversleep_dev_ns += PACER_OVERSLEEP_WEIGHT * (fabs(error) - pacer->oversleep_dev_ns);
+}
+
+static void pacer_record_frame(PlatformFramePacer *pacer, uint64_t now) {
+  if (pacer->last_frame_ns) {
+    double frame = (double)(now - pacer->last_frame_ns);
+    pacer->frames++;
+    pacer->frame_sum_ns += frame;
+    pacer->frame_sum_sq_ns += frame * frame;
+    if (pacer->target_ns) {
+      uint64_t error = (uint64_t)fabs(frame - (double)pacer->target_ns);
+      if (error > pacer->max_error_ns)
+        pacer->max_error_ns = error;
+    }
+  }
+  pacer->last_frame_ns = now;
+
+  if (pacer->report_interval_ns && now - pacer->report_start_ns >= pacer->report_interval_ns &&
+      pacer->frames) {
+    PlatformFramePacerStats stats = Platform_FramePacerGetStats(pacer);
+    Platform_Log("Frame pacing: %u frames, %.3f ms mean, %.3f ms jitter, %.3f ms worst error, %u missed "
+                 "(spin window %.3f ms)",
+                 stats.frames, stats.mean_frame_ms, stats.jitter_ms, stats.max_error_ms, stats.missed,
+                 ns_to_ms((double)pacer_spin_window(pacer)));
+    Platform_FramePacerResetStats(pacer);
+  }
+}
+
+void Platform_FramePacerWait(PlatformFramePacer *pacer) {
+  uint64_t now = Platform_GetTicksNS();
+
+  if (pacer->target_ns) {
+    if (pacer->deadline_ns == 0) {
+      pacer->deadline_ns = now + pacer->target_ns;
+    }
+
+    if (now < pacer->deadline_ns) {
+      uint64_t spin_window = pacer_spin_window(pacer);
+      uint64_t oversleep = sleep_until_hybrid(pacer->deadline_ns, spin_window);
+      if (pacer->deadline_ns - now > spin_window) {
+        pacer_learn_oversleep(pacer, oversleep); // Only frames that actually slept say anything
+      }
+      now = Platform_GetTicksNS();
+      pacer->deadline_ns += pacer->target_ns;
+    } else {
+      // Late: don't try to win the time back with short frames, just restart the cadence
+      pacer->missed++;
+      pacer->deadline_ns = now + pacer->target_ns;
+    }
+  }
+
+  pacer_record_frame(pacer, now);
+}
+
+PlatformFramePacerStats Platform_FramePacerGetStats(const PlatformFramePacer *pacer) {
+  PlatformFramePacerStats stats = {0};
+  stats.frames = pacer->frames;
+  stats.missed = pacer->missed;
+  if (pacer->frames) {
+    double mean = pacer->frame_sum_ns / pacer->frames;
+    double variance = pacer->frame_sum_sq_ns / pacer->frames - mean * mean;
+    stats.mean_frame_ms = ns_to_ms(mean);
+    stats.jitter_ms = ns_to_ms(variance > 0.0 ? sqrt(variance) : 0.0);
+    stats.max_error_ms = ns_to_ms((double)pacer->max_error_ns);
+  }
+  return stats;
+}
+
+void Platform_FramePacerResetStats(PlatformFramePacer *pacer) {
+  pacer->report_start_ns = Platform_GetTicksNS();
+  pacer->frames = 0;
+  pacer->missed = 0;
+  pacer->frame_sum_ns = 0.0;
+  pacer->frame_sum_sq_ns = 0.0;
+  pacer->max_error_ns = 0;
+}
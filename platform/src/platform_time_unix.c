@@ -0,0 +1,34 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#include "platform.h"
+#include <errno.h>
+#include <time.h>
+
+void Platform_Sleep(uint64_t ns) {
+  // Absolute deadline: a signal interrupting the sleep resumes towards the same wake time
+  // instead of restarting the full duration
+  struct timespec deadline;
+  clock_gettime(CLOCK_MONOTONIC, &deadline);
+  uint64_t nsec = (uint64_t)deadline.tv_nsec + ns;
+  deadline.tv_sec += (time_t)(nsec / 1000000000ull);
+  deadline.tv_nsec = (long)(nsec % 1000000000ull);
+
+#ifdef __APPLE__
+  // No clock_nanosleep: sleep relative to whatever is left
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  while (now.tv_sec < deadline.tv_sec || (now.tv_sec == deadline.tv_sec && now.tv_nsec < deadline.tv_nsec)) {
+    struct timespec left = {deadline.tv_sec - now.tv_sec, deadline.tv_nsec - now.tv_nsec};
+    if (left.tv_nsec < 0) {
+      left.tv_sec--;
+      left.tv_nsec += 1000000000L;
+    }
+    nanosleep(&left, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &now);
+  }
+#else
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+  }
+#endif
+}
@@ -0,0 +1,11 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#include "platform.h"
+
+// The browser paces frames (requestAnimationFrame) and the main thread must never block, so
+// there is nothing to sleep on: Platform_SleepUntil degrades to a spin, which the frame pacer
+// never reaches with a target of 0.
+void Platform_Sleep(uint64_t ns) {
+  (void)ns;
+}
@@ -5,15 +5,23 @@
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_main.h>
 #include <platform.h>
+#include <platform_frame_pacer.h>
 #include <stdio.h>
 #include <stdint.h>
 
+// Frame rate cap (FLIGHT_TARGET_FPS in CMake, 0 = unlimited). The browser paces web builds itself.
+#if !defined(FLIGHT_TARGET_FPS) || defined(__EMSCRIPTEN__)
+#undef FLIGHT_TARGET_FPS
+#define FLIGHT_TARGET_FPS 0
+#endif
+
 #ifdef SDL_MAIN_USE_CALLBACKS
 
 const float nanoSecondsToSeconds = (1.0f / 1000000000.0f);
 uint64_t prevFrameTimeNS = 0;
 uint64_t currentTimeNS = 0;
 float deltaTime = 0.0f;
+PlatformFramePacer framePacer;
 
 // Called once at the start of the application
 SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[]) {
@@ -40,6 +48,10 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[]) {
   }
 
   Platform_Log("Initialization complete.");
+
+  // The first frame's dt starts now, not at boot (startup time isn't simulation time)
+  Platform_FramePacerInit(&framePacer, FLIGHT_TARGET_FPS);
+  prevFrameTimeNS = Platform_GetTicksNS();
   return SDL_APP_CONTINUE;
 }
 
@@ -78,8 +90,9 @@ SDL_AppResult SDL_AppIterate(void *appstate) { // NOLINT (Function signatures ma
   deltaTime = (float)(currentTimeNS - prevFrameTimeNS) * nanoSecondsToSeconds;
   prevFrameTimeNS = currentTimeNS;
 
-  Engine_Update(deltaTime);
-  Engine_Render();
+  Engine_Frame(deltaTime);
+  Platform_EndFrame();
+  Platform_FramePacerWait(&framePacer);
 
   return SDL_APP_CONTINUE; // Continue the loop
 }
@@ -103,6 +116,7 @@ int main(int argc, char* argv[]) {
   uint64_t currentTimeNS = 0;
   float deltaTime = 0.0f;
   bool running = false;
+  PlatformFramePacer framePacer;
 
   // Initialize platform (creates root arena)
   if (!Platform_Init()) {
@@ -130,6 +144,8 @@ int main(int argc, char* argv[]) {
 
   // Main loop
   running = true;
+  Platform_FramePacerInit(&framePacer, FLIGHT_TARGET_FPS);
+  prevFrameTimeNS = Platform_GetTicksNS();
 
   while (running) {
     currentTimeNS = Platform_GetTicksNS();
@@ -151,14 +167,13 @@ int main(int argc, char* argv[]) {
       // engine_handle_event(&event);
     }
 
-    // Update
-    Engine_Update(deltaTime);
-
-    // Render
-    Engine_Render();
+    // Fixed simulation ticks for the time that has passed, then render between the last two
+    // (pipelined: render the previous frame while this one simulates)
+    Engine_Frame(deltaTime);
+    Platform_EndFrame();
 
-    // Optional: Frame rate limiting
-    // platform_sleep(target_frame_time - delta_time);
+    // Sleep out the rest of the frame instead of spinning into the next one
+    Platform_FramePacerWait(&framePacer);
   }
 
   // Cleanup
@@ -4,7 +4,9 @@
 #include "platform.h"
 
 #include "platform_api.h"
+#include "platform_memory.h"
 #include "platform_renderer.h"
+#include "platform_thread.h"
 #include "platform_window.h"
 #include <SDL3/SDL.h>
 #include <stdarg.h>
@@ -17,6 +19,34 @@ static PlatformAPI g_platform_api = {
     .LogError = Platform_LogError,
     .LogWarning = Platform_LogWarning,
     .GetTicksNS = Platform_GetTicksNS,
+    .Sleep = Platform_Sleep,
+    .SleepUntil = Platform_SleepUntil,
+
+    .ThreadCreate = Platform_ThreadCreate,
+    .ThreadJoin = Platform_ThreadJoin,
+    .ThreadSetName = Platform_ThreadSetName,
+    .ThreadSetAffinity = Platform_ThreadSetAffinity,
+    .ThreadYield = Platform_ThreadYield,
+    .GetThreadID = Platform_GetThreadID,
+    .GetCPUCount = Platform_GetCPUCount,
+    .MutexCreate = Platform_MutexCreate,
+    .MutexDestroy = Platform_MutexDestroy,
+    .MutexLock = Platform_MutexLock,
+    .MutexTryLock = Platform_MutexTryLock,
+    .MutexUnlock = Platform_MutexUnlock,
+    .ConditionCreate = Platform_ConditionCreate,
+    .ConditionDestroy = Platform_ConditionDestroy,
+    .ConditionWait = Platform_ConditionWait,
+    .ConditionWaitTimeout = Platform_ConditionWaitTimeout,
+    .ConditionSignal = Platform_ConditionSignal,
+    .ConditionBroadcast = Platform_ConditionBroadcast,
+    .SemaphoreCreate = Platform_SemaphoreCreate,
+    .SemaphoreDestroy = Platform_SemaphoreDestroy,
+    .SemaphoreWait = Platform_SemaphoreWait,
+    .SemaphoreTryWait = Platform_SemaphoreTryWait,
+    .SemaphorePost = Platform_SemaphorePost,
+    .WaitOnAddress = Platform_WaitOnAddress,
+    .WakeOnAddress = Platform_WakeOnAddress,
 
     .CreateWindow = Platform_CreateWindow,
     .DestroyWindow = Platform_DestroyWindow,
@@ -38,6 +68,7 @@ static PlatformAPI g_platform_api = {
     // Arena functions
     .GetRootArena = Platform_GetRootArena,
     .ArenaCreateBump = Arena_CreateBump,
+    .ArenaCreateConcurrentBump = Arena_CreateConcurrentBump,
     .ArenaCreateStack = Arena_CreateStack,
     .ArenaCreateBlock = Arena_CreateBlock,
     .ArenaCreateMultiPool = Arena_CreateMultiPool,
@@ -45,6 +76,9 @@ static PlatformAPI g_platform_api = {
     .ArenaDestroy = Arena_Destroy,
     .ArenaAlloc = Arena_Alloc,
     .ArenaAllocAligned = Arena_AllocAligned,
+    .ArenaFree = Arena_Free,
+    .ArenaTryExtend = Arena_TryExtend,
+    .ArenaRealloc = Arena_Realloc,
     .ArenaReset = Arena_Reset,
     .ArenaGetUsed = Arena_GetUsed,
     .ArenaGetPeakUsed = Arena_GetPeakUsed,
@@ -54,6 +88,31 @@ static PlatformAPI g_platform_api = {
     .ArenaPopTo = Arena_PopTo,
     .ArenaBeginTemp = Arena_BeginTemp,
     .ArenaEndTemp = Arena_EndTemp,
+    .ArenaGetThreadScratch = Arena_GetThreadScratch,
+    .ArenaReleaseThreadScratch = Arena_ReleaseThreadScratch,
+    .ArenaDumpHierarchy = Arena_DumpHierarchy,
+    .ArenaTraceGetEvents = Arena_TraceGetEvents,
+
+    // Arena-backed containers
+    .ArenaArrayCreate = ArenaArray_Create,
+    .ArenaArrayReserve = ArenaArray_Reserve,
+    .ArenaArrayPush = ArenaArray_Push,
+    .ArenaArrayPushN = ArenaArray_PushN,
+    .ArenaArrayClear = ArenaArray_Clear,
+    .ArenaStringCreate = ArenaString_Create,
+    .ArenaStringAppend = ArenaString_Append,
+    .ArenaStringAppendCStr = ArenaString_AppendCStr,
+    .ArenaStringAppendf = ArenaString_Appendf,
+    .ArenaStringClear = ArenaString_Clear,
+
+    // Handle arenas
+    .HandleArenaCreate = HandleArena_Create,
+    .HandleArenaDestroy = HandleArena_Destroy,
+    .HandleArenaAlloc = HandleArena_Alloc,
+    .HandleArenaFree = HandleArena_Free,
+    .HandleArenaPin = HandleArena_Pin,
+    .HandleArenaUnpin = HandleArena_Unpin,
+    .HandleArenaCompact = HandleArena_Compact,
 };
 
 PlatformAPI *Platform_GetAPI(void) {
@@ -64,9 +123,29 @@ Arena *Platform_GetRootArena(void) {
   return g_platform_root_arena;
 }
 
+PlatformConfig Platform_DefaultConfig(void) {
+  PlatformConfig config = {
+      .root_reserve_size = GIGABYTES(4),
+      .root_commit_size = MEGABYTES(64),
+      .root_arena_flags = ARENA_VIRTUAL_HUGE_PAGES,
+  };
+  return config;
+}
+
 bool Platform_Init(void) {
+  PlatformConfig config = Platform_DefaultConfig();
+  return Platform_InitWithConfig(&config);
+}
+
+bool Platform_InitWithConfig(const PlatformConfig *config) {
+  PlatformConfig defaults = Platform_DefaultConfig();
+  if (!config) {
+    config = &defaults;
+  }
+
   // Create the one and only root arena
-  g_platform_root_arena = Arena_CreateVirtual(GIGABYTES(4), MEGABYTES(64));
+  g_platform_root_arena = Arena_CreateVirtual(config->root_reserve_size, config->root_commit_size,
+                                              config->root_arena_flags);
   if (!g_platform_root_arena) {
     Platform_LogError("Failed to create root arena!");
     return false;
@@ -75,10 +154,25 @@ bool Platform_Init(void) {
   Arena_SetDebugName(g_platform_root_arena, "Platform Root");
   Platform_Log("Platform initialized - root arena created");
 
+  Arena_TraceConfigureDump(config->arena_dump_path, config->arena_dump_interval, config->arena_dump_format);
+
+  PlatformMemoryStats stats = Platform_MemoryGetStats();
+  if (stats.huge_page_size) {
+    Platform_Log("Huge pages: %zu KB page size, %zu KB currently backed",
+                 stats.huge_page_size / 1024, stats.huge_page_bytes / 1024);
+  }
+
   return true;
 }
 
+void Platform_EndFrame(void) {
+  Arena_TraceEndFrame(g_platform_root_arena);
+}
+
 void Platform_Shutdown(void) {
+  // Main thread's scratch arenas live outside the root reservation
+  Arena_ReleaseThreadScratch();
+
   if (g_platform_root_arena) {
     Platform_Log("Platform shutting down - destroying root arena");
     Arena_Destroy(g_platform_root_arena);
@@ -123,3 +217,7 @@ const char *Platform_GetPrefPath(const char *org, const char *app) {
 uint64_t Platform_GetTicksNS(void) {
   return SDL_GetTicksNS();
 }
+
+uint64_t Platform_GetThreadID(void) {
+  return (uint64_t)SDL_GetCurrentThreadID();
+}
@@ -0,0 +1,247 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#include "platform.h"
+#include "platform_atomic.h"
+#include "platform_thread.h"
+#include <SDL3/SDL.h>
+
+// Portable backend (Windows, web, anything without pthreads). SDL has no thread naming after
+// creation, no affinity and no futex, so those degrade: see each function.
+
+struct PlatformThread {
+  SDL_Thread *sdl_thread;
+};
+
+struct PlatformMutex {
+  SDL_Mutex *sdl_mutex;
+};
+
+struct PlatformCondition {
+  SDL_Condition *sdl_condition;
+};
+
+struct PlatformSemaphore {
+  SDL_Semaphore *sdl_semaphore;
+};
+
+// SDL waits take milliseconds: round up so a short timeout still waits, and keep in range
+static Sint32 timeout_to_ms(uint64_t timeout_ns) {
+  if (timeout_ns == PLATFORM_WAIT_FOREVER)
+    return -1;
+  uint64_t ms = (timeout_ns + 999999ull) / 1000000ull;
+  return ms > (uint64_t)SDL_MAX_SINT32 ? SDL_MAX_SINT32 : (Sint32)ms;
+}
+
+// ============================================================================
+// Threads
+// ============================================================================
+PlatformThread *Platform_ThreadCreate(PlatformThreadFunc func, const char *name, void *data) {
+  PlatformThread *thread = SDL_calloc(1, sizeof(PlatformThread));
+  if (!thread)
+    return NULL;
+
+  thread->sdl_thread = SDL_CreateThread(func, name, data);
+  if (!thread->sdl_thread) {
+    Platform_LogError("Failed to create thread '%s': %s", name, SDL_GetError());
+    SDL_free(thread);
+    return NULL;
+  }
+  return thread;
+}
+
+int Platform_ThreadJoin(PlatformThread *thread) {
+  if (!thread)
+    return 0;
+
+  int result = 0;
+  SDL_WaitThread(thread->sdl_thread, &result);
+  SDL_free(thread);
+  return result;
+}
+
+void Platform_ThreadSetName(const char *name) {
+  // SDL only names threads it creates
+  (void)name;
+}
+
+bool Platform_ThreadSetAffinity(PlatformThread *thread, uint64_t cpu_mask) {
+  (void)thread;
+  (void)cpu_mask;
+  return false;
+}
+
+void Platform_ThreadYield(void) {
+  SDL_DelayNS(0);
+}
+
+uint32_t Platform_GetCPUCount(void) {
+  int count = SDL_GetNumLogicalCPUCores();
+  return count > 0 ? (uint32_t)count : 1;
+}
+
+// ============================================================================
+// Mutexes and condition variables
+// ============================================================================
+PlatformMutex *Platform_MutexCreate(void) {
+  PlatformMutex *mutex = SDL_calloc(1, sizeof(PlatformMutex));
+  if (!mutex)
+    return NULL;
+
+  mutex->sdl_mutex = SDL_CreateMutex();
+  if (!mutex->sdl_mutex) {
+    Platform_LogError("Failed to create mutex: %s", SDL_GetError());
+    SDL_free(mutex);
+    return NULL;
+  }
+  return mutex;
+}
+
+void Platform_MutexDestroy(PlatformMutex *mutex) {
+  if (mutex) {
+    SDL_DestroyMutex(mutex->sdl_mutex);
+    SDL_free(mutex);
+  }
+}
+
+void Platform_MutexLock(PlatformMutex *mutex) {
+  SDL_LockMutex(mutex->sdl_mutex);
+}
+
+bool Platform_MutexTryLock(PlatformMutex *mutex) {
+  return SDL_TryLockMutex(mutex->sdl_mutex);
+}
+
+void Platform_MutexUnlock(PlatformMutex *mutex) {
+  SDL_UnlockMutex(mutex->sdl_mutex);
+}
+
+PlatformCondition *Platform_ConditionCreate(void) {
+  PlatformCondition *condition = SDL_calloc(1, sizeof(PlatformCondition));
+  if (!condition)
+    return NULL;
+
+  condition->sdl_condition = SDL_CreateCondition();
+  if (!condition->sdl_condition) {
+    Platform_LogError("Failed to create condition variable: %s", SDL_GetError());
+    SDL_free(condition);
+    return NULL;
+  }
+  return condition;
+}
+
+void Platform_ConditionDestroy(PlatformCondition *condition) {
+  if (condition) {
+    SDL_DestroyCondition(condition->sdl_condition);
+    SDL_free(condition);
+  }
+}
+
+void Platform_ConditionWait(PlatformCondition *condition, PlatformMutex *mutex) {
+  SDL_WaitCondition(condition->sdl_condition, mutex->sdl_mutex);
+}
+
+bool Platform_ConditionWaitTimeout(PlatformCondition *condition, PlatformMutex *mutex, uint64_t timeout_ns) {
+  return SDL_WaitConditionTimeout(condition->sdl_condition, mutex->sdl_mutex, timeout_to_ms(timeout_ns));
+}
+
+void Platform_ConditionSignal(PlatformCondition *condition) {
+  SDL_SignalCondition(condition->sdl_condition);
+}
+
+void Platform_ConditionBroadcast(PlatformCondition *condition) {
+  SDL_BroadcastCondition(condition->sdl_condition);
+}
+
+// ============================================================================
+// Semaphores
+// ============================================================================
+PlatformSemaphore *Platform_SemaphoreCreate(uint32_t initial_count) {
+  PlatformSemaphore *semaphore = SDL_calloc(1, sizeof(PlatformSemaphore));
+  if (!semaphore)
+    return NULL;
+
+  semaphore->sdl_semaphore = SDL_CreateSemaphore(initial_count);
+  if (!semaphore->sdl_semaphore) {
+    Platform_LogError("Failed to create semaphore: %s", SDL_GetError());
+    SDL_free(semaphore);
+    return NULL;
+  }
+  return semaphore;
+}
+
+void Platform_SemaphoreDestroy(PlatformSemaphore *semaphore) {
+  if (semaphore) {
+    SDL_DestroySemaphore(semaphore->sdl_semaphore);
+    SDL_free(semaphore);
+  }
+}
+
+void Platform_SemaphoreWait(PlatformSemaphore *semaphore) {
+  SDL_WaitSemaphore(semaphore->sdl_semaphore);
+}
+
+bool Platform_SemaphoreTryWait(PlatformSemaphore *semaphore) {
+  return SDL_TryWaitSemaphore(semaphore->sdl_semaphore);
+}
+
+void Platform_SemaphorePost(PlatformSemaphore *semaphore, uint32_t count) {
+  for (uint32_t i = 0; i < count; ++i) {
+    SDL_SignalSemaphore(semaphore->sdl_semaphore);
+  }
+}
+
+// ============================================================================
+// Address waits
+// ============================================================================
+// Waiters park on one of a fixed set of mutex/condition buckets picked by address. Unrelated
+// addresses can share a bucket, so a wake broadcasts and waiters re-check their value.
+#define PARKING_BUCKET_COUNT 64
+
+typedef struct ParkingBucket {
+  SDL_Mutex *mutex;
+  SDL_Condition *condition;
+} ParkingBucket;
+
+static ParkingBucket g_parking_buckets[PARKING_BUCKET_COUNT];
+static SDL_InitState g_parking_init;
+
+static ParkingBucket *parking_bucket(volatile uint32_t *address) {
+  if (SDL_ShouldInit(&g_parking_init)) {
+    bool ok = true;
+    for (int i = 0; i < PARKING_BUCKET_COUNT; ++i) {
+      g_parking_buckets[i].mutex = SDL_CreateMutex();
+      g_parking_buckets[i].condition = SDL_CreateCondition();
+      ok = ok && g_parking_buckets[i].mutex && g_parking_buckets[i].condition;
+    }
+    if (!ok) {
+      Platform_LogError("Failed to create address wait buckets: %s", SDL_GetError());
+    }
+    SDL_SetInitialized(&g_parking_init, ok);
+  }
+
+  uintptr_t key = (uintptr_t)address >> 2;
+  return &g_parking_buckets[(key ^ (key >> 6)) % PARKING_BUCKET_COUNT];
+}
+
+bool Platform_WaitOnAddress(volatile uint32_t *address, uint32_t expected, uint64_t timeout_ns) {
+  ParkingBucket *bucket = parking_bucket(address);
+  bool woken = true;
+
+  SDL_LockMutex(bucket->mutex);
+  if (Platform_AtomicLoadU32(address) == expected) {
+    woken = SDL_WaitConditionTimeout(bucket->condition, bucket->mutex, timeout_to_ms(timeout_ns));
+  }
+  SDL_UnlockMutex(bucket->mutex);
+  return woken;
+}
+
+void Platform_WakeOnAddress(volatile uint32_t *address, bool wake_all) {
+  (void)wake_all;
+  ParkingBucket *bucket = parking_bucket(address);
+
+  // Taking the lock orders the wake after any waiter's value check
+  SDL_LockMutex(bucket->mutex);
+  SDL_BroadcastCondition(bucket->condition);
+  SDL_UnlockMutex(bucket->mutex);
+}
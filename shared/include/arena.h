@@ -29,6 +29,7 @@ struct Arena {
 
   union {
     BumpArenaData bump;
+    ConcurrentBumpArenaData concurrent_bump;
     StackArenaData stack;
     BlockArenaData block;
     MultiPoolArenaData multi_pool;
@@ -43,21 +44,41 @@ struct Arena {
 
 // Create Virtual arena - ONLY called by Platform_Init!
 // This is the root arena that all others chain from
-Arena *Arena_CreateVirtual(size_t reserve_size, size_t commit_size);
+// flags are ArenaVirtualFlags (huge pages, pre-fault); unsupported options fall back silently.
+Arena *Arena_CreateVirtual(size_t reserve_size, size_t commit_size, uint32_t flags);
+
+// Tune how a Virtual arena commits and returns physical memory.
+// Growth commits whole commit_granularity chunks (fewer syscalls on the hot path).
+// When usage drops (Arena_PopTo/Arena_EndTemp, or destroying the topmost child) and the
+// committed-but-unused tail exceeds decommit_threshold, the tail is returned to the OS,
+// keeping one granularity chunk of slack. A decommit_threshold of 0 disables shrinking.
+void Arena_SetCommitPolicy(Arena *arena, size_t commit_granularity, size_t decommit_threshold);
 
 // Create Bump arena (linear allocator)
 Arena *Arena_CreateBump(Arena *parent, size_t size, size_t alignment);
 
+// Create Concurrent Bump arena (linear, lock-free allocation from any thread)
+// Allocation is a single atomic fetch-add. Reset/Destroy are NOT thread-safe: call
+// them at a sync point (e.g. frame boundary) when no thread is allocating.
+Arena *Arena_CreateConcurrentBump(Arena *parent, size_t size, size_t alignment);
+
 // Create Stack arena (push/pop with markers)
 Arena *Arena_CreateStack(Arena *parent, size_t size, size_t alignment);
 
-// Create Block arena (fixed-size pool)
+// Create Block arena (fixed-size pool, O(1) alloc/free via intrusive free-list)
+// Block size is padded to alignment; pass CACHE_LINE_SIZE to keep blocks on separate cache lines.
 Arena *Arena_CreateBlock(Arena *parent, size_t block_size, size_t block_count, size_t alignment);
 
-// Create Multi-pool arena (power-of-2 size classes)
+// Create Multi-pool arena (power-of-2 size classes, 16..2048 bytes)
+// total_size is split evenly across the classes; each class is a child Block arena, so
+// per-class stats are Arena_GetUsed/Arena_GetPeakUsed(arena->data.multi_pool.pools[i]).
+// Requests larger than 2048 bytes (or overflowing every fitting class) fall back to the parent.
+// Arena_Free and Arena_Reset return those to the parent when it can take them back (a pool, or
+// the top of a linear arena); otherwise the multi-pool keeps them for later large requests.
+// Arena_GetUsed/Arena_GetPeakUsed on the multi-pool count the parent-served bytes as well.
 Arena *Arena_CreateMultiPool(Arena *parent, size_t total_size);
 
-// Create Scratch arena (temporary scoped)
+// Create Scratch arena (temporary scoped, owned by the creating thread)
 Arena *Arena_CreateScratch(Arena *parent, size_t size, size_t alignment);
 
 // ============================================================================
@@ -73,6 +94,26 @@ void *Arena_Alloc(Arena *arena, size_t size);
 // Allocate memory with specific alignment
 void *Arena_AllocAligned(Arena *arena, size_t size, size_t alignment);
 
+// Return a single allocation to its arena (Block and Multi-pool arenas)
+void Arena_Free(Arena *arena, void *ptr);
+
+// Grow (or shrink) an allocation in place. Succeeds when ptr is the most recent
+// allocation of a Bump/Stack/Virtual/Scratch arena and there is room, or when the
+// new size still fits ptr's block in a Block/Multi-pool arena. Never moves memory.
+bool Arena_TryExtend(Arena *arena, void *ptr, size_t old_size, size_t new_size);
+
+// Resize an allocation: extends in place when possible, otherwise allocates and copies
+// old_size bytes. Block/Multi-pool arenas free the old allocation; linear arenas leave
+// it until reset. ptr == NULL behaves like Arena_AllocAligned. Returns NULL on failure
+// (ptr stays valid).
+void *Arena_Realloc(Arena *arena, void *ptr, size_t old_size, size_t new_size, size_t alignment);
+
+// Arena_Realloc for a buffer with slack (arrays, string builders): old_size is what was
+// allocated, which is what in-place extension checks against, but only the first used_size
+// bytes are copied if it has to move.
+void *Arena_ReallocUsed(Arena *arena, void *ptr, size_t old_size, size_t used_size, size_t new_size,
+                        size_t alignment);
+
 // Reset arena (behavior depends on type)
 void Arena_Reset(Arena *arena);
 
@@ -88,7 +129,7 @@ void Arena_SetDebugName(Arena *arena, const char *name);
 // Stack Arena Specific Operations
 // ============================================================================
 
-// Save current position
+// Save current position (Stack and Virtual arenas)
 ArenaMarker Arena_Mark(Arena *arena);
 
 // Pop back to saved position
@@ -104,6 +145,28 @@ ArenaTemp Arena_BeginTemp(Arena *arena);
 // End temporary allocation scope
 void Arena_EndTemp(ArenaTemp temp);
 
+// ============================================================================
+// Per-Thread Scratch Arenas
+// ============================================================================
+
+// Each thread lazily gets ARENA_THREAD_SCRATCH_COUNT scratch arenas, each backed by its
+// own ARENA_THREAD_SCRATCH_RESERVE of reserved virtual memory (committed on demand).
+// Acquire/release is thread-local, so there are no locks and no contention.
+#define ARENA_THREAD_SCRATCH_COUNT 2
+#ifndef ARENA_THREAD_SCRATCH_RESERVE
+#define ARENA_THREAD_SCRATCH_RESERVE ((size_t)256 * 1024 * 1024)
+#endif
+
+// Get a scratch arena for the calling thread that is not any of `conflicts`.
+// Pass the arena(s) your result will be allocated from, so scratch work never
+// stomps on memory the caller still needs:
+//   Arena *scratch = Arena_GetThreadScratch(&out_arena, 1);
+//   ARENA_TEMP(scratch) { ... }   // scratch auto-resets when the outermost scope ends
+Arena *Arena_GetThreadScratch(Arena **conflicts, size_t conflict_count);
+
+// Release the calling thread's scratch arenas (call before a worker thread exits)
+void Arena_ReleaseThreadScratch(void);
+
 // ============================================================================
 // Helper Macros
 // ============================================================================
@@ -122,6 +185,10 @@ void Arena_EndTemp(ArenaTemp temp);
 #define MEGABYTES(n) ((size_t)(n) * 1024 * 1024)
 #define GIGABYTES(n) ((size_t)(n) * 1024 * 1024 * 1024)
 
+// Virtual arena commit policy defaults (see Arena_SetCommitPolicy)
+#define ARENA_VIRTUAL_COMMIT_GRANULARITY MEGABYTES(2)
+#define ARENA_VIRTUAL_DECOMMIT_THRESHOLD MEGABYTES(64)
+
 // Common alignments
 #define DEFAULT_ALIGNMENT 8
 #define SIMD_ALIGNMENT 16
@@ -140,6 +207,81 @@ void Arena_EndTemp(ArenaTemp temp);
        _once;                                                         \
        Arena_EndTemp(_temp), _once = NULL)
 
+// ============================================================================
+// Inline Fast Paths (Bump and Stack arenas)
+// ============================================================================
+
+// Branch hint for the fast paths below
+#if defined(__GNUC__) || defined(__clang__)
+#define ARENA_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#define ARENA_UNLIKELY(x) (x)
+#endif
+
+// Traced builds must inline the pushes at every call site, or every push made through one
+// translation unit's out-of-line copy would be recorded at the same call site
+#if defined(FLIGHT_ENABLE_ARENA_TRACE) && (defined(__GNUC__) || defined(__clang__))
+#define ARENA_PUSH_INLINE static inline __attribute__((always_inline))
+#elif defined(FLIGHT_ENABLE_ARENA_TRACE) && defined(_MSC_VER)
+#define ARENA_PUSH_INLINE static __forceinline
+#else
+#define ARENA_PUSH_INLINE static inline
+#endif
+
+// Out-of-line slow path for the inline pushes: reports a wrong arena type or
+// out-of-memory and returns NULL. Never grows the arena.
+void *Arena_PushSlow(Arena *arena, ArenaType expected_type, size_t size, size_t alignment);
+
+// Shared body: align, add, one bounds check. Peak usage isn't tracked here; it's
+// folded in by Reset/PopTo/EndTemp and Arena_GetPeakUsed instead.
+ARENA_PUSH_INLINE void *arena_push_linear(Arena *arena, size_t *offset, ArenaType type,
+                                          size_t size, size_t alignment) {
+  uintptr_t base = (uintptr_t)arena->base;
+  uintptr_t aligned_ptr = ALIGN_UP(base + *offset, (uintptr_t)alignment);
+  size_t new_offset = (size_t)(aligned_ptr - base) + size;
+  if (ARENA_UNLIKELY(new_offset > arena->size)) {
+    return Arena_PushSlow(arena, type, size, alignment);
+  }
+
+  *offset = new_offset;
+  arena->used = new_offset;
+  return (void *)aligned_ptr;
+}
+
+// Allocate from a Bump arena without going through Arena_AllocAligned.
+// arena must be a non-NULL Bump arena (checked in debug builds) and alignment a power of two.
+ARENA_PUSH_INLINE void *Arena_BumpPush(Arena *arena, size_t size, size_t alignment) {
+#ifndef NDEBUG
+  if (arena->type != ARENA_TYPE_BUMP)
+    return Arena_PushSlow(arena, ARENA_TYPE_BUMP, size, alignment);
+#endif
+#ifdef FLIGHT_ENABLE_ARENA_TRACE
+  return Arena_AllocAligned(arena, size, alignment); // Traced builds record every push
+#else
+  return arena_push_linear(arena, &arena->data.bump.offset, ARENA_TYPE_BUMP, size, alignment);
+#endif
+}
+
+// Allocate from a Stack arena without going through Arena_AllocAligned.
+// Same contract as Arena_BumpPush; pairs with Arena_Mark/Arena_PopTo as usual.
+ARENA_PUSH_INLINE void *Arena_StackPush(Arena *arena, size_t size, size_t alignment) {
+#ifndef NDEBUG
+  if (arena->type != ARENA_TYPE_STACK)
+    return Arena_PushSlow(arena, ARENA_TYPE_STACK, size, alignment);
+#endif
+#ifdef FLIGHT_ENABLE_ARENA_TRACE
+  return Arena_AllocAligned(arena, size, alignment);
+#else
+  return arena_push_linear(arena, &arena->data.stack.offset, ARENA_TYPE_STACK, size, alignment);
+#endif
+}
+
+#define Arena_BumpPushType(arena, type) \
+  (type *)Arena_BumpPush(arena, sizeof(type), _Alignof(type))
+
+#define Arena_BumpPushArray(arena, type, count) \
+  (type *)Arena_BumpPush(arena, sizeof(type) * (count), _Alignof(type))
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,89 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#ifndef ARENA_ARRAY_H
+#define ARENA_ARRAY_H
+
+#include "arena.h"
+
+#include <stdarg.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Arena Array (growable, arena-backed)
+// ============================================================================
+
+// Growth goes through Arena_ReallocUsed, so an array that is the most recent allocation
+// in a Bump/Stack/Virtual/Scratch arena grows in place with no copy. Interleaving
+// other allocations from the same arena makes the next growth copy (the old storage
+// is reclaimed when the arena resets). Build big per-frame lists in their own
+// arena or scratch arena to keep growth copy-free.
+typedef struct ArenaArray {
+  Arena *arena;
+  void *data;
+  size_t count;     // Elements in use
+  size_t capacity;  // Elements allocated
+  size_t elem_size; // Bytes per element
+  size_t alignment; // Element alignment
+} ArenaArray;
+
+// Create an array of elem_size elements. initial_capacity may be 0 (allocates on first push).
+ArenaArray ArenaArray_Create(Arena *arena, size_t elem_size, size_t alignment, size_t initial_capacity);
+
+// Make room for at least capacity elements. Returns false if the arena is out of memory.
+bool ArenaArray_Reserve(ArenaArray *array, size_t capacity);
+
+// Append count uninitialized elements and return a pointer to the first (NULL on failure)
+void *ArenaArray_PushN(ArenaArray *array, size_t count);
+
+// Append one uninitialized element
+void *ArenaArray_Push(ArenaArray *array);
+
+// Drop every element (keeps capacity)
+void ArenaArray_Clear(ArenaArray *array);
+
+// Type-aware helpers
+#define ArenaArray_Init(arena, type, initial_capacity) \
+  ArenaArray_Create(arena, sizeof(type), _Alignof(type), initial_capacity)
+
+#define ArenaArray_PushType(array, type) \
+  ((type *)ArenaArray_Push(array))
+
+#define ArenaArray_At(array, type, index) \
+  (((type *)(array)->data)[index])
+
+// ============================================================================
+// Arena String Builder
+// ============================================================================
+
+// Same growth rules as ArenaArray. data is always NUL-terminated (when non-NULL).
+typedef struct ArenaString {
+  Arena *arena;
+  char *data;
+  size_t length;   // Characters, excluding the terminator
+  size_t capacity; // Bytes allocated, including the terminator
+} ArenaString;
+
+ArenaString ArenaString_Create(Arena *arena, size_t initial_capacity);
+
+// Append len bytes of str. Returns false if the arena is out of memory.
+bool ArenaString_Append(ArenaString *string, const char *str, size_t len);
+
+// Append a NUL-terminated string
+bool ArenaString_AppendCStr(ArenaString *string, const char *str);
+
+// Append printf-style formatted text
+bool ArenaString_Appendf(ArenaString *string, const char *fmt, ...);
+bool ArenaString_AppendfV(ArenaString *string, const char *fmt, va_list args);
+
+// Drop the contents (keeps capacity)
+void ArenaString_Clear(ArenaString *string);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
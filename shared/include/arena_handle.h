@@ -0,0 +1,111 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#ifndef ARENA_HANDLE_H
+#define ARENA_HANDLE_H
+
+#include "arena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Handle Arena (relocatable allocations + incremental compaction)
+// ============================================================================
+
+// For long-lived data freed out of order (level chunks, audio buffers, UI text).
+// Callers hold 32-bit generational handles instead of pointers, so the arena is
+// free to slide live allocations down over holes a few KB at a time each frame
+// (HandleArena_Compact) and the footprint stays flat over a long session.
+//
+// Pointers from HandleArena_Resolve are only stable until the next HandleArena_Compact
+// or HandleArena_Alloc: resolve on use, or pin across the frame.
+
+// Handle layout: | generation (12 bits) | slot index (20 bits) |. 0 is never a valid handle.
+typedef uint32_t ArenaHandle;
+#define ARENA_HANDLE_INVALID 0u
+#define ARENA_HANDLE_INDEX_BITS 20
+#define ARENA_HANDLE_INDEX_MASK ((1u << ARENA_HANDLE_INDEX_BITS) - 1)
+#define ARENA_HANDLE_MAX_SLOTS (1u << ARENA_HANDLE_INDEX_BITS)
+
+// Every allocation is aligned to this, and moves preserve it
+#define ARENA_HANDLE_ALIGNMENT 16
+
+typedef struct ArenaHandleSlot {
+  uint32_t offset;     // Payload offset into the heap
+  uint32_t size;       // Payload size (rounded up to ARENA_HANDLE_ALIGNMENT)
+  uint16_t generation; // Bumped on free; stale handles stop resolving
+  uint16_t pin_count;  // Pinned allocations are never moved
+  uint32_t next_free;  // Free slot list link (index + 1, 0 = end)
+} ArenaHandleSlot;
+
+typedef struct HandleArena {
+  Arena *storage; // Child arena holding this struct, the slot table and the heap
+
+  char *heap;
+  size_t heap_size;
+  size_t top;        // Bump offset for new allocations
+  size_t hole_bytes; // Freed bytes below top not yet reclaimed
+
+  ArenaHandleSlot *slots;
+  uint32_t slot_count;     // Slots in use at least once
+  uint32_t max_slots;
+  uint32_t free_slot_head; // index + 1, 0 = empty
+  uint32_t live_count;
+
+  // Incremental compaction cursor: live blocks in [compact_scan, top) still need
+  // to slide down to compact_dest. Equal (and 0) when no pass is in progress.
+  size_t compact_scan;
+  size_t compact_dest;
+
+  size_t bytes_moved_total;
+} HandleArena;
+
+// Create a handle arena with heap_size bytes for allocations and up to max_handles live handles
+HandleArena *HandleArena_Create(Arena *parent, size_t heap_size, uint32_t max_handles);
+
+// Destroy the handle arena (its storage is a child of parent, so destroying the parent also works)
+void HandleArena_Destroy(HandleArena *handles);
+
+// Allocate size bytes. Returns ARENA_HANDLE_INVALID when out of slots or memory
+// (a full compaction is attempted before giving up on memory).
+ArenaHandle HandleArena_Alloc(HandleArena *handles, size_t size);
+
+// Free an allocation. Stale or invalid handles are ignored (logged in debug builds).
+void HandleArena_Free(HandleArena *handles, ArenaHandle handle);
+
+// Keep an allocation in place while raw pointers to it are held (nests)
+void HandleArena_Pin(HandleArena *handles, ArenaHandle handle);
+void HandleArena_Unpin(HandleArena *handles, ArenaHandle handle);
+
+// Move at most max_bytes of live data down over holes. Call once per frame with a budget
+// (e.g. KILOBYTES(64)); pass SIZE_MAX to compact fully. Returns the bytes moved.
+size_t HandleArena_Compact(HandleArena *handles, size_t max_bytes);
+
+// Resolve a handle to its current address (NULL if freed or invalid)
+static inline void *HandleArena_Resolve(const HandleArena *handles, ArenaHandle handle) {
+  uint32_t index = handle & ARENA_HANDLE_INDEX_MASK;
+  if (ARENA_UNLIKELY(index >= handles->slot_count))
+    return NULL;
+
+  const ArenaHandleSlot *slot = &handles->slots[index];
+  if (ARENA_UNLIKELY(slot->generation != (handle >> ARENA_HANDLE_INDEX_BITS)))
+    return NULL;
+
+  return handles->heap + slot->offset;
+}
+
+static inline bool HandleArena_IsValid(const HandleArena *handles, ArenaHandle handle) {
+  return HandleArena_Resolve(handles, handle) != NULL;
+}
+
+// Type-aware helper
+#define HandleArena_Get(handles, type, handle) \
+  ((type *)HandleArena_Resolve(handles, handle))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,97 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#ifndef ARENA_TRACE_H
+#define ARENA_TRACE_H
+
+#include "arena_types.h"
+
+// Return address of the current function: the call site of an arena call.
+// Resolve with addr2line/llvm-symbolizer (subtract the module load address for PIE builds).
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define ARENA_CALL_SITE() ((const void *)_ReturnAddress())
+#elif defined(__GNUC__) || defined(__clang__)
+#define ARENA_CALL_SITE() ((const void *)__builtin_return_address(0))
+#else
+#define ARENA_CALL_SITE() ((const void *)0)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Allocation Tracing (opt-in: configure with -DFLIGHT_ARENA_TRACE=ON)
+// ============================================================================
+
+// Events recorded into the ring buffer (oldest are overwritten). Must be a power of 2.
+#ifndef ARENA_TRACE_CAPACITY
+#define ARENA_TRACE_CAPACITY 65536
+#endif
+
+typedef enum ArenaTraceKind {
+  ARENA_TRACE_ALLOC,  // ptr/size/alignment of a new allocation
+  ARENA_TRACE_FREE,   // Arena_Free (size is the block size returned)
+  ARENA_TRACE_EXTEND, // Arena_TryExtend in place (size is the new size)
+  ARENA_TRACE_POP,    // Arena_PopTo/Arena_EndTemp (size is the bytes released)
+  ARENA_TRACE_RESET,  // Arena_Reset (size is the bytes released)
+} ArenaTraceKind;
+
+typedef struct ArenaTraceEvent {
+  uint64_t frame;        // Arena_TraceEndFrame count when recorded
+  const Arena *arena;    // Matches "address" in hierarchy dumps
+  const void *ptr;       // Allocation (NULL for pop/reset)
+  const void *call_site; // ARENA_CALL_SITE() of the arena call
+  uint64_t size;
+  uint32_t alignment;
+  uint32_t kind; // ArenaTraceKind
+} ArenaTraceEvent;
+
+typedef enum ArenaDumpFormat {
+  ARENA_DUMP_JSON,   // Human-readable, nested "children"
+  ARENA_DUMP_BINARY, // Compact: header, pre-order node records, then trace events
+} ArenaDumpFormat;
+
+#ifdef FLIGHT_ENABLE_ARENA_TRACE
+// Record one event. Lock-free; safe from any thread.
+void Arena_TraceRecord(const Arena *arena, ArenaTraceKind kind, const void *ptr,
+                       size_t size, size_t alignment, const void *call_site);
+#define ARENA_TRACE_AT(arena, kind, ptr, size, alignment, call_site) \
+  Arena_TraceRecord(arena, kind, ptr, size, alignment, call_site)
+#else
+#define ARENA_TRACE_AT(arena, kind, ptr, size, alignment, call_site) ((void)(call_site))
+#endif
+
+// ARENA_CALL_SITE() is only the caller's call site when evaluated in the public entry point
+// itself; internal helpers take it as a parameter and use ARENA_TRACE_AT
+#define ARENA_TRACE(arena, kind, ptr, size, alignment) \
+  ARENA_TRACE_AT(arena, kind, ptr, size, alignment, ARENA_CALL_SITE())
+
+// Copy up to max_events of the most recent events, oldest first. Returns the count copied
+// (always 0 unless built with FLIGHT_ENABLE_ARENA_TRACE). Events being written concurrently
+// may be torn; call from the main thread between frames for a clean snapshot.
+size_t Arena_TraceGetEvents(ArenaTraceEvent *out_events, size_t max_events);
+
+// Frame counter stamped on events and dump file names
+uint64_t Arena_TraceGetFrame(void);
+
+// ============================================================================
+// Hierarchy Dump (always available)
+// ============================================================================
+
+// Write root and all of its descendants (used/peak/capacity/committed/fragmentation per
+// arena) plus any recorded trace events. Returns false if the file can't be written.
+bool Arena_DumpHierarchy(Arena *root, const char *path, ArenaDumpFormat format);
+
+// Dump to "<path_prefix>_<frame>.json|.bin" every interval_frames frames (0 disables)
+void Arena_TraceConfigureDump(const char *path_prefix, uint32_t interval_frames, ArenaDumpFormat format);
+
+// Advance the frame counter and write any periodic dump. Called once per frame by the platform.
+void Arena_TraceEndFrame(Arena *root);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
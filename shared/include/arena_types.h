@@ -23,41 +23,77 @@ typedef enum ArenaType {
   ARENA_TYPE_BLOCK,      // Pool: fixed-size blocks with free-list
   ARENA_TYPE_MULTI_POOL, // Multiple pools (power-of-2 sizes)
   ARENA_TYPE_SCRATCH,    // Temporary scoped allocations
+  ARENA_TYPE_CONCURRENT_BUMP, // Linear, shared across threads (lock-free atomic offset)
 } ArenaType;
 
+// Virtual arena backing options (Arena_CreateVirtual / PlatformConfig)
+typedef enum ArenaVirtualFlags {
+  ARENA_VIRTUAL_DEFAULT = 0,
+  ARENA_VIRTUAL_HUGE_PAGES = 1 << 0,          // Transparent huge pages (madvise) where available
+  ARENA_VIRTUAL_HUGE_PAGES_EXPLICIT = 1 << 1, // Explicit huge page mapping (MAP_HUGETLB), falls back to transparent
+  ARENA_VIRTUAL_PREFAULT = 1 << 2,            // Fault in committed pages at commit time, not on first touch
+} ArenaVirtualFlags;
+
 // Per-Type Arena Data
 typedef struct BumpArenaData {
   size_t offset; // Current allocation offset from base
 } BumpArenaData;
 
+typedef struct ConcurrentBumpArenaData {
+  volatile size_t offset; // Allocation offset from base, advanced with atomic fetch-add
+} ConcurrentBumpArenaData;
+
 typedef struct StackArenaData {
   size_t offset;    // Current top of stack
   size_t peak_used; // Peak usage (for debugging)
 } StackArenaData;
 
 typedef struct BlockArenaData {
-  size_t block_size;  // Size of each block
-  size_t block_count; // Total number of blocks
-  void *free_list;    // Head of free list
-  size_t free_count;  // Available blocks
+  size_t block_size;   // Size of each block (padded to alignment)
+  size_t block_count;  // Total number of blocks
+  void *free_list;     // Head of intrusive free list (next ptr lives in the block)
+  size_t free_count;   // Available blocks (free list + never-carved)
+  size_t carved_count; // Blocks handed out at least once (lazy carve from base)
 } BlockArenaData;
 
+#define ARENA_MULTI_POOL_CLASS_COUNT 8
+
+// Header in front of a multi-pool allocation served by the parent (oversize or overflow)
+typedef struct ArenaFallbackBlock {
+  struct ArenaFallbackBlock *next;
+  void *payload;   // What the caller got
+  size_t capacity; // Payload bytes the block can hold
+  size_t size;     // Bytes asked for by the current owner
+  size_t lead;     // Alignment padding the parent put in front of the block (given back with it)
+} ArenaFallbackBlock;
+
 typedef struct MultiPoolArenaData {
-  Arena *pools[8];        // One arena per size class
-  size_t size_classes[8]; // {16, 32, 64, 128, 256, 512, 1024, 2048}
+  Arena *pools[ARENA_MULTI_POOL_CLASS_COUNT];        // One block arena per size class
+  size_t size_classes[ARENA_MULTI_POOL_CLASS_COUNT]; // {16, 32, 64, 128, 256, 512, 1024, 2048}
+  ArenaFallbackBlock *fallback_live;                 // Parent-served allocations in use
+  ArenaFallbackBlock *fallback_free;                 // Freed ones the parent couldn't take back, reused first
+  size_t fallback_used;                              // Live bytes served by the parent
+  size_t fallback_cached;                            // Capacity held in fallback_free
 } MultiPoolArenaData;
 
 typedef struct VirtualArenaData {
   size_t reserve_size;       // Total address space reserved
   size_t commit_size;        // Currently committed
   size_t page_size;          // OS page size
-  size_t commit_granularity; // Commit in chunks
+  size_t commit_granularity; // Commit ahead in chunks of this size
+  size_t decommit_threshold; // Decommit once committed exceeds used by this much (0 = never)
+  size_t min_commit_size;    // Never decommit below the initial commit
+  size_t commit_count;       // Commit syscalls issued (growth)
+  size_t decommit_count;     // Decommit syscalls issued (shrink)
+  uint32_t flags;            // ArenaVirtualFlags actually in effect
 } VirtualArenaData;
 
 typedef struct ScratchArenaData {
-  size_t offset;      // Current offset
-  uint32_t thread_id; // Owning thread
-  bool auto_reset;    // Auto-reset on scope exit
+  size_t offset;       // Current offset
+  size_t commit_size;  // Committed bytes (thread scratch owns its reservation; 0 = parent-backed)
+  uint64_t thread_id;  // Owning thread
+  uint32_t temp_depth; // Open Arena_BeginTemp scopes
+  bool auto_reset;     // Auto-reset when the outermost temp scope ends
 } ScratchArenaData;
 
 // Helper Types
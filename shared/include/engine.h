@@ -5,14 +5,41 @@
 #define FLIGHT_ENGINE_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 bool Engine_Initialize(void);
+
+// Fixed-timestep frame: feed the real time since the last frame. Runs as many Engine_Update ticks
+// of 1/tick rate seconds as have built up (at most ENGINE_MAX_CATCHUP_TICKS; time beyond that is
+// dropped rather than spiralling) and returns the interpolation alpha to pass to Engine_Render.
+float Engine_Advance(float frameTime);
+
+// Simulation tick rate (ticks per second). Defaults to ENGINE_TICK_RATE (FLIGHT_TICK_RATE in CMake).
+void Engine_SetTickRate(uint32_t ticksPerSecond);
+uint32_t Engine_GetTickRate(void);
+
+// One simulation tick of deltaTime seconds (Engine_Advance calls this with the fixed step)
 void Engine_Update(float deltaTime);
-void Engine_Render();
+
+// alpha (0..1): how far real time is between the last tick and the next one. Plugins read it
+// through EngineAPI.GetRenderAlpha.
+void Engine_Render(float alpha);
+
+// One frame: Engine_Advance then Engine_Render, or, when pipelined, render the previous frame's
+// snapshot while a simulation thread advances this one. The main loop calls this.
+void Engine_Frame(float frameTime);
+
+// Pipelined frames trade a frame of latency for overlapping simulation with render. Updates then
+// run on the simulation thread (so they mustn't touch the window or renderer), and every plugin
+// needs PluginAPI.snapshot and render_snapshot; returns false if that isn't met or the thread
+// can't start. Defaults to ENGINE_PIPELINED (FLIGHT_PIPELINED_FRAMES in CMake).
+bool Engine_SetPipelined(bool enabled);
+bool Engine_IsPipelined(void);
+
 void Engine_Shutdown(void);
 
 #ifdef __cplusplus
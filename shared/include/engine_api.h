@@ -6,14 +6,32 @@
 
 #include "engine_api_enums.h"
 #include "engine_api_types.h"
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Extensions get a dense integer ID in registration order (index into the engine's extension table)
+typedef uint32_t ExtensionID;
+#define EXTENSION_ID_INVALID UINT32_MAX
+
 // Engine API - All engine core and extension services available to plugins
 typedef struct EngineAPI {
+  // Name lookup (string compares): resolve once and cache the result, don't call per use
   void* (*GetExtensionAPI)(const char* name);
+
+  // Resolve a name to its ID once (EXTENSION_ID_INVALID if not registered), then fetch by ID in O(1)
+  ExtensionID (*GetExtensionID)(const char* name);
+  void* (*GetExtensionAPIByID)(ExtensionID id);
+
+  // Fixed-timestep interpolation for render: how far real time is between the last simulation tick
+  // and the next (0..1). Draw previous and current state blended by it.
+  float (*GetRenderAlpha)(void);
+
+  // Threads in the engine's worker pool (plugin updates, extension init), for extensions that start
+  // their own threads and want to leave those cores alone
+  uint32_t (*GetWorkerCount)(void);
 } EngineAPI;
 
 // Getter for engine API (implemented by engine layer)
@@ -19,17 +19,52 @@ extern "C" {
 typedef struct EngineAPI EngineAPI;
 typedef struct PlatformAPI PlatformAPI;
 
+// Where in the frame an extension's Update runs. The default (0) is after the game's update.
+typedef enum ExtensionPhase {
+  EXTENSION_PHASE_POST_GAME = 0, // After the game/plugins update
+  EXTENSION_PHASE_PRE_GAME,      // Before the game/plugins update
+  EXTENSION_PHASE_PRE_RENDER,    // Start of Engine_Render, before the game draws
+  EXTENSION_PHASE_COUNT
+} ExtensionPhase;
+
+// How often Update runs. The default (0) is once per frame with the frame's dt.
+typedef enum ExtensionUpdateRate {
+  EXTENSION_UPDATE_EVERY_FRAME = 0,
+  EXTENSION_UPDATE_EVERY_N_FRAMES, // Every update_interval frames, with the dt of all of them
+  EXTENSION_UPDATE_FIXED_STEP,     // update_step seconds per call, as many calls as time has passed
+} ExtensionUpdateRate;
+
+// A fixed-step extension that falls behind catches up at most this many steps in one frame;
+// anything older is dropped rather than spiralling
+#define EXTENSION_MAX_CATCHUP_STEPS 4
+
 // The interface for compile-time engine extensions. These are bolted on to the core engine statically in
 // the specified configuration and are used to add core functionality for both core and plugins.
 typedef struct ExtensionInterface {
   const char *name;
   uint32_t version;
+  uint32_t id; // ExtensionID, assigned by Engine_RegisterExtension
 
   // Lifecycle hooks
   bool (*Init)(EngineAPI *engine, PlatformAPI *platform);
   void (*Update)(float dt);
   void (*Shutdown)(void);
 
+  // Update scheduling. Static builds generate the dispatch from the definition (tools/manifest_gen.c),
+  // so phase and update_rate must be written as the enum names, not computed.
+  ExtensionPhase phase;
+  ExtensionUpdateRate update_rate;
+  uint32_t update_interval; // EXTENSION_UPDATE_EVERY_N_FRAMES
+  float update_step;        // EXTENSION_UPDATE_FIXED_STEP, in seconds
+
+  // Startup. Extensions initialise in parallel on the engine's worker pool, each one after the
+  // extensions named in dependencies (NULL-terminated list of names, NULL = none). A lazy extension
+  // is skipped at startup and initialised by the first lookup of its API (GetExtensionAPI /
+  // GetExtensionAPIByID, or a plugin's first macro call into it); its Update doesn't run before.
+  // Write lazy as true/false: static builds read it from the source like phase.
+  const char *const *dependencies;
+  bool lazy;
+
   // The Payload: Returns the specific API struct
   void *(*GetSpecificAPI)(void);
 } ExtensionInterface;
@@ -0,0 +1,43 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#ifndef JOBS_TYPES_H
+#define JOBS_TYPES_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Job entry points. A range job gets one chunk [begin, end) of a Jobs_ParallelFor.
+typedef void (*JobFunc)(void *data);
+typedef void (*JobRangeFunc)(void *data, uint32_t begin, uint32_t end);
+
+// One job of a Jobs_Run / Jobs_RunAfter batch
+typedef struct JobDecl {
+  JobFunc func;
+  void *data;
+} JobDecl;
+
+// Counts unfinished jobs: Jobs_Run adds to it, every job that finishes subtracts one, and
+// Jobs_Wait / Jobs_RunAfter wait for it to reach zero. Owned by the caller (stack, arena,
+// game state); zero-initialise it and don't touch the fields directly.
+typedef struct JobCounter {
+  volatile uint32_t value;    // Unfinished jobs, plus a lock bit while continuations are handled
+  struct Job *continuations;  // Jobs_RunAfter jobs waiting for zero (guarded by the lock bit)
+} JobCounter;
+
+// Totals across every thread since the last Jobs_ResetStats
+typedef struct JobStats {
+  uint64_t executed;     // Jobs run (including ParallelFor chunks)
+  uint64_t stolen;       // Jobs taken from another worker's deque
+  uint64_t inlined;      // Jobs run on the submitting thread because its queue or pool was full
+  uint32_t worker_count; // Job threads (the thread calling Jobs_Wait helps as well)
+} JobStats;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // JOBS_TYPES_H
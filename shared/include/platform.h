@@ -5,6 +5,7 @@
 #define FLIGHT_PLATFORM_H
 
 #include "arena.h"
+#include "arena_trace.h"
 
 #include <stdint.h>
 
@@ -13,7 +14,7 @@ Memory: platform_alloc, platform_free, platform_realloc (wrapper around your all
 Logging: platform_log, platform_log_error, platform_log_warn (with printf-style formatting)
 Timing: platform_get_time, platform_get_delta_time, platform_sleep
 File I/O: platform_read_file, platform_write_file, platform_file_exists, platform_get_file_size
-Threading: platform_create_thread, platform_mutex_create/lock/unlock, platform_semaphore_*
+Threading: see platform_thread.h
 
 Nice to Have:
 
@@ -27,16 +28,44 @@ Path utilities: platform_get_base_path, platform_get_pref_path
 extern "C" {
 #endif
 
+// Startup configuration for the root arena. Platform_Init() uses
+// Platform_DefaultConfig(); hosts that want explicit huge pages or a
+// pre-faulted commit can tweak the defaults and call Platform_InitWithConfig().
+typedef struct PlatformConfig {
+  size_t root_reserve_size;
+  size_t root_commit_size;
+  uint32_t root_arena_flags; // ArenaVirtualFlags
+
+  // Periodic arena hierarchy dumps (see Arena_TraceConfigureDump); NULL/0 disables
+  const char *arena_dump_path;
+  uint32_t arena_dump_interval;
+  ArenaDumpFormat arena_dump_format;
+} PlatformConfig;
+
 // Platform initialization/shutdown
+PlatformConfig Platform_DefaultConfig(void);
 bool Platform_Init(void);
+bool Platform_InitWithConfig(const PlatformConfig *config);
 void Platform_Shutdown(void);
 
+// Once per frame, after render: frame counters, periodic arena dumps
+void Platform_EndFrame(void);
+
 void Platform_Log(const char *fmt, ...);
 void Platform_LogError(const char *fmt, ...);
 void Platform_LogWarning(const char *fmt, ...);
 const char *Platform_GetBasePath(void);
 const char *Platform_GetPrefPath(const char *org, const char *app);
 uint64_t Platform_GetTicksNS(void);
+
+// Block the calling thread for at least ns nanoseconds. An OS sleep: it can wake late by the
+// scheduler's timer slack (tens of microseconds on Linux, up to a millisecond on Windows).
+void Platform_Sleep(uint64_t ns);
+
+// Return as close to target_ns (a Platform_GetTicksNS time) as possible: OS sleep for most of
+// the wait, then spin for the last stretch. Returns at once if target_ns has passed.
+void Platform_SleepUntil(uint64_t target_ns);
+uint64_t Platform_GetThreadID(void);
 Arena *Platform_GetRootArena(void);
 
 #ifdef __cplusplus
@@ -5,8 +5,12 @@
 #define PLATFORM_API_H
 
 #include "arena.h"
+#include "arena_array.h"
+#include "arena_handle.h"
+#include "arena_trace.h"
 #include "platform_api_enums.h"
 #include "platform_api_types.h"
+#include "platform_thread.h"
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -23,6 +27,35 @@ typedef struct PlatformAPI {
 
   // Timing
   uint64_t (*GetTicksNS)(void);
+  void (*Sleep)(uint64_t ns);
+  void (*SleepUntil)(uint64_t target_ns);
+
+  // Threading
+  PlatformThread *(*ThreadCreate)(PlatformThreadFunc func, const char *name, void *data);
+  int (*ThreadJoin)(PlatformThread *thread);
+  void (*ThreadSetName)(const char *name);
+  bool (*ThreadSetAffinity)(PlatformThread *thread, uint64_t cpu_mask);
+  void (*ThreadYield)(void);
+  uint64_t (*GetThreadID)(void);
+  uint32_t (*GetCPUCount)(void);
+  PlatformMutex *(*MutexCreate)(void);
+  void (*MutexDestroy)(PlatformMutex *mutex);
+  void (*MutexLock)(PlatformMutex *mutex);
+  bool (*MutexTryLock)(PlatformMutex *mutex);
+  void (*MutexUnlock)(PlatformMutex *mutex);
+  PlatformCondition *(*ConditionCreate)(void);
+  void (*ConditionDestroy)(PlatformCondition *condition);
+  void (*ConditionWait)(PlatformCondition *condition, PlatformMutex *mutex);
+  bool (*ConditionWaitTimeout)(PlatformCondition *condition, PlatformMutex *mutex, uint64_t timeout_ns);
+  void (*ConditionSignal)(PlatformCondition *condition);
+  void (*ConditionBroadcast)(PlatformCondition *condition);
+  PlatformSemaphore *(*SemaphoreCreate)(uint32_t initial_count);
+  void (*SemaphoreDestroy)(PlatformSemaphore *semaphore);
+  void (*SemaphoreWait)(PlatformSemaphore *semaphore);
+  bool (*SemaphoreTryWait)(PlatformSemaphore *semaphore);
+  void (*SemaphorePost)(PlatformSemaphore *semaphore, uint32_t count);
+  bool (*WaitOnAddress)(volatile uint32_t *address, uint32_t expected, uint64_t timeout_ns);
+  void (*WakeOnAddress)(volatile uint32_t *address, bool wake_all);
 
   // Window Management
   PlatformWindow *(*CreateWindow)(const char *title, int32_t width, int32_t height, PlatformRendererType type);
@@ -46,6 +79,7 @@ typedef struct PlatformAPI {
   // Memory / Arena Management
   Arena *(*GetRootArena)(void);
   Arena *(*ArenaCreateBump)(Arena *parent, size_t size, size_t alignment);
+  Arena *(*ArenaCreateConcurrentBump)(Arena *parent, size_t size, size_t alignment);
   Arena *(*ArenaCreateStack)(Arena *parent, size_t size, size_t alignment);
   Arena *(*ArenaCreateBlock)(Arena *parent, size_t block_size, size_t count, size_t alignment);
   Arena *(*ArenaCreateMultiPool)(Arena *parent, size_t total_size);
@@ -53,6 +87,9 @@ typedef struct PlatformAPI {
   void (*ArenaDestroy)(Arena *arena);
   void *(*ArenaAlloc)(Arena *arena, size_t size);
   void *(*ArenaAllocAligned)(Arena *arena, size_t size, size_t alignment);
+  void (*ArenaFree)(Arena *arena, void *ptr);
+  bool (*ArenaTryExtend)(Arena *arena, void *ptr, size_t old_size, size_t new_size);
+  void *(*ArenaRealloc)(Arena *arena, void *ptr, size_t old_size, size_t new_size, size_t alignment);
   void (*ArenaReset)(Arena *arena);
   size_t (*ArenaGetUsed)(Arena *arena);
   size_t (*ArenaGetPeakUsed)(Arena *arena);
@@ -62,6 +99,31 @@ typedef struct PlatformAPI {
   void (*ArenaPopTo)(Arena *arena, ArenaMarker marker);
   ArenaTemp (*ArenaBeginTemp)(Arena *arena);
   void (*ArenaEndTemp)(ArenaTemp temp);
+  Arena *(*ArenaGetThreadScratch)(Arena **conflicts, size_t conflict_count);
+  void (*ArenaReleaseThreadScratch)(void);
+  bool (*ArenaDumpHierarchy)(Arena *root, const char *path, ArenaDumpFormat format);
+  size_t (*ArenaTraceGetEvents)(ArenaTraceEvent *out_events, size_t max_events);
+
+  // Arena-backed containers
+  ArenaArray (*ArenaArrayCreate)(Arena *arena, size_t elem_size, size_t alignment, size_t initial_capacity);
+  bool (*ArenaArrayReserve)(ArenaArray *array, size_t capacity);
+  void *(*ArenaArrayPush)(ArenaArray *array);
+  void *(*ArenaArrayPushN)(ArenaArray *array, size_t count);
+  void (*ArenaArrayClear)(ArenaArray *array);
+  ArenaString (*ArenaStringCreate)(Arena *arena, size_t initial_capacity);
+  bool (*ArenaStringAppend)(ArenaString *string, const char *str, size_t len);
+  bool (*ArenaStringAppendCStr)(ArenaString *string, const char *str);
+  bool (*ArenaStringAppendf)(ArenaString *string, const char *fmt, ...);
+  void (*ArenaStringClear)(ArenaString *string);
+
+  // Handle arenas (relocatable allocations)
+  HandleArena *(*HandleArenaCreate)(Arena *parent, size_t heap_size, uint32_t max_handles);
+  void (*HandleArenaDestroy)(HandleArena *handles);
+  ArenaHandle (*HandleArenaAlloc)(HandleArena *handles, size_t size);
+  void (*HandleArenaFree)(HandleArena *handles, ArenaHandle handle);
+  void (*HandleArenaPin)(HandleArena *handles, ArenaHandle handle);
+  void (*HandleArenaUnpin)(HandleArena *handles, ArenaHandle handle);
+  size_t (*HandleArenaCompact)(HandleArena *handles, size_t max_bytes);
 } PlatformAPI;
 
 // Getter for platform API (implemented by platform layer)
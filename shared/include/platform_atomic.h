@@ -0,0 +1,145 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#ifndef PLATFORM_ATOMIC_H
+#define PLATFORM_ATOMIC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Header-only atomic operations on plain (volatile) integers.
+// Compiler intrinsics instead of C11 <stdatomic.h> so shared structs stay plain C
+// types that any language (and MSVC) can lay out and read over FFI.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+
+static inline size_t Platform_AtomicLoadSize(const volatile size_t *ptr) {
+  size_t value = *ptr; // Aligned loads are atomic on x64/ARM64
+  _ReadWriteBarrier();
+  return value;
+}
+
+static inline void Platform_AtomicStoreSize(volatile size_t *ptr, size_t value) {
+  _ReadWriteBarrier();
+  *ptr = value;
+}
+
+static inline size_t Platform_AtomicFetchAddSize(volatile size_t *ptr, size_t value) {
+  return (size_t)_InterlockedExchangeAdd64((volatile __int64 *)ptr, (__int64)value);
+}
+
+static inline bool Platform_AtomicCompareExchangeSize(volatile size_t *ptr, size_t *expected, size_t desired) {
+  __int64 previous = _InterlockedCompareExchange64((volatile __int64 *)ptr, (__int64)desired, (__int64)*expected);
+  if ((size_t)previous == *expected) {
+    return true;
+  }
+  *expected = (size_t)previous;
+  return false;
+}
+
+static inline uint32_t Platform_AtomicLoadU32(const volatile uint32_t *ptr) {
+  uint32_t value = *ptr;
+  _ReadWriteBarrier();
+  return value;
+}
+
+static inline void Platform_AtomicStoreU32(volatile uint32_t *ptr, uint32_t value) {
+  _ReadWriteBarrier();
+  *ptr = value;
+}
+
+static inline uint32_t Platform_AtomicFetchAddU32(volatile uint32_t *ptr, uint32_t value) {
+  return (uint32_t)_InterlockedExchangeAdd((volatile long *)ptr, (long)value);
+}
+
+static inline bool Platform_AtomicCompareExchangeU32(volatile uint32_t *ptr, uint32_t *expected, uint32_t desired) {
+  long previous = _InterlockedCompareExchange((volatile long *)ptr, (long)desired, (long)*expected);
+  if ((uint32_t)previous == *expected) {
+    return true;
+  }
+  *expected = (uint32_t)previous;
+  return false;
+}
+
+static inline void Platform_AtomicFence(void) {
+#if defined(_M_ARM64)
+  __dmb(_ARM64_BARRIER_ISH);
+#else
+  __faststorefence();
+#endif
+}
+
+#else
+
+static inline size_t Platform_AtomicLoadSize(const volatile size_t *ptr) {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+static inline void Platform_AtomicStoreSize(volatile size_t *ptr, size_t value) {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+static inline size_t Platform_AtomicFetchAddSize(volatile size_t *ptr, size_t value) {
+  return __atomic_fetch_add(ptr, value, __ATOMIC_RELAXED);
+}
+
+static inline bool Platform_AtomicCompareExchangeSize(volatile size_t *ptr, size_t *expected, size_t desired) {
+  return __atomic_compare_exchange_n(ptr, expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+// 32-bit variants (the width Platform_WaitOnAddress sleeps on)
+static inline uint32_t Platform_AtomicLoadU32(const volatile uint32_t *ptr) {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+static inline void Platform_AtomicStoreU32(volatile uint32_t *ptr, uint32_t value) {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+static inline uint32_t Platform_AtomicFetchAddU32(volatile uint32_t *ptr, uint32_t value) {
+  return __atomic_fetch_add(ptr, value, __ATOMIC_ACQ_REL);
+}
+
+static inline bool Platform_AtomicCompareExchangeU32(volatile uint32_t *ptr, uint32_t *expected, uint32_t desired) {
+  return __atomic_compare_exchange_n(ptr, expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+// Full (sequentially consistent) barrier: orders a store before a later load of another
+// variable, which acquire/release alone doesn't (work-stealing deques, sleep/wake handshakes)
+static inline void Platform_AtomicFence(void) {
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#endif
+
+// Raise *ptr to value if it is larger (lock-free high-water mark)
+static inline void Platform_AtomicMaxSize(volatile size_t *ptr, size_t value) {
+  size_t current = Platform_AtomicLoadSize(ptr);
+  while (value > current && !Platform_AtomicCompareExchangeSize(ptr, &current, value)) {
+  }
+}
+
+// Spin-wait hint: tells the core (and a hyperthread sibling) the loop is only polling
+static inline void Platform_CPURelax(void) {
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_ARM64)
+  __yield();
+#elif defined(_MSC_VER) && !defined(__clang__)
+  _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
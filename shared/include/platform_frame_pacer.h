@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#ifndef FLIGHT_PLATFORM_FRAME_PACER_H
+#define FLIGHT_PLATFORM_FRAME_PACER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Holds the main loop to a target frame time without burning a core: at the end of each frame it
+// sleeps until just before the frame's deadline and spins the rest. How early to stop sleeping is
+// learnt from how late the OS has been waking up, so frames land within microseconds of the
+// target. A frame that is already late isn't waited on, and the next deadline restarts from it.
+typedef struct PlatformFramePacer {
+  uint64_t target_ns;   // Frame time to hold (0 = don't wait, only measure)
+  uint64_t deadline_ns; // When the current frame should end
+  uint64_t last_frame_ns;
+
+  // Spin window: oversleep mean and mean deviation (exponential moving averages)
+  double oversleep_ns;
+  double oversleep_dev_ns;
+
+  // Frame time statistics since the last report
+  uint64_t report_interval_ns; // Log the statistics this often (0 = never)
+  uint64_t report_start_ns;
+  uint32_t frames;
+  uint32_t missed;          // Frames that ended after their deadline
+  double frame_sum_ns;
+  double frame_sum_sq_ns;
+  uint64_t max_error_ns;    // Worst distance of a frame from target_ns
+} PlatformFramePacer;
+
+typedef struct PlatformFramePacerStats {
+  uint32_t frames;
+  uint32_t missed;
+  double mean_frame_ms;
+  double jitter_ms;    // Standard deviation of the frame time
+  double max_error_ms; // Worst distance of a frame from the target
+} PlatformFramePacerStats;
+
+// target_fps 0 = unlimited (the pacer only measures)
+void Platform_FramePacerInit(PlatformFramePacer *pacer, uint32_t target_fps);
+void Platform_FramePacerSetTargetFPS(PlatformFramePacer *pacer, uint32_t target_fps);
+
+// Call once per frame, after presenting: waits out the rest of the frame
+void Platform_FramePacerWait(PlatformFramePacer *pacer);
+
+// Statistics since the last report (or reset)
+PlatformFramePacerStats Platform_FramePacerGetStats(const PlatformFramePacer *pacer);
+void Platform_FramePacerResetStats(PlatformFramePacer *pacer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -4,7 +4,9 @@
 #ifndef PLATFORM_PLUGIN_H
 #define PLATFORM_PLUGIN_H
 
+#include "arena_types.h"
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -12,21 +14,56 @@ extern "C" {
 
 typedef struct PlatformPlugin PlatformPlugin;
 
-// Load a plugin DLL/SO
-PlatformPlugin* Platform_PluginLoad(const char* path);
+// Load a plugin DLL/SO. The record is allocated from arena, which must be able to free it
+// (e.g. a Block arena of Platform_PluginRecordSize() blocks) so unloading hands it back.
+// NULL allocates from the root arena, where it is never reclaimed.
+PlatformPlugin* Platform_PluginLoad(const char* path, Arena* arena);
 
-// Unload a plugin
+// Unload a plugin and free its record
 void Platform_PluginUnload(PlatformPlugin* plugin);
 
+// Bytes Platform_PluginLoad allocates per plugin (size the record arena's blocks with this)
+size_t Platform_PluginRecordSize(void);
+
+// Path the plugin was loaded from
+const char* Platform_PluginGetPath(const PlatformPlugin* plugin);
+
 // Get a symbol (function pointer) from plugin
 void* Platform_PluginGetSymbol(PlatformPlugin* plugin, const char* name);
 
-// Check if plugin file has changed (for hot reload)
+// Check if plugin file has changed and finished being written (for hot reload). Cheap enough to
+// call every frame: on Linux it drains an inotify queue rather than stat()ing the file, and only
+// reports a change once the file has been closed and left alone for a short debounce window.
 bool Platform_PluginNeedsReload(PlatformPlugin* plugin);
 
-// Reload a plugin (unload and load again)
+// Reload a plugin, blocking until the new build is loaded (the old version stays loaded if it fails)
 bool Platform_PluginReload(PlatformPlugin* plugin);
 
+// ============================================================================
+// Asynchronous Reload
+// ============================================================================
+// The new build is copied and loaded on a background thread while the current one keeps
+// running; the caller swaps it in at a frame boundary. The previous build stays loaded
+// after a swap (for Platform_PluginRevertReload) until the next reload starts.
+typedef enum PlatformPluginReloadStatus {
+  PLATFORM_PLUGIN_RELOAD_IDLE,    // Nothing staged
+  PLATFORM_PLUGIN_RELOAD_LOADING, // Background copy/load in progress
+  PLATFORM_PLUGIN_RELOAD_READY,   // New build loaded, waiting for Platform_PluginSwapReload
+  PLATFORM_PLUGIN_RELOAD_FAILED,  // Staging failed, current build untouched (reported once, then IDLE)
+} PlatformPluginReloadStatus;
+
+// Start staging the current build of the plugin file. False if a reload is already in flight.
+bool Platform_PluginBeginReload(PlatformPlugin* plugin);
+
+// Non-blocking status check
+PlatformPluginReloadStatus Platform_PluginGetReloadStatus(PlatformPlugin* plugin);
+
+// Make the staged build current (READY only). Symbols resolve against it from here on.
+bool Platform_PluginSwapReload(PlatformPlugin* plugin);
+
+// Undo the last swap (e.g. the new build is missing an entry point) and unload the new build
+void Platform_PluginRevertReload(PlatformPlugin* plugin);
+
 #ifdef __cplusplus
 }
 #endif
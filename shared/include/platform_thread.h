@@ -0,0 +1,99 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// All rights reserved.
+
+#ifndef FLIGHT_PLATFORM_THREAD_H
+#define FLIGHT_PLATFORM_THREAD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Threading primitives. Two backends: native pthreads (Linux/macOS, the default there) and SDL
+// (everything else). FLIGHT_THREAD_BACKEND in CMake picks one.
+
+typedef struct PlatformThread PlatformThread;
+typedef struct PlatformMutex PlatformMutex;
+typedef struct PlatformCondition PlatformCondition;
+typedef struct PlatformSemaphore PlatformSemaphore;
+
+// Timeout for the waits that take one
+#define PLATFORM_WAIT_FOREVER UINT64_MAX
+
+// ============================================================================
+// Threads
+// ============================================================================
+
+// Thread entry point; the return value is handed back by Platform_ThreadJoin
+typedef int (*PlatformThreadFunc)(void *data);
+
+// Start a thread running func(data). name shows up in debuggers/profilers. NULL on failure.
+PlatformThread *Platform_ThreadCreate(PlatformThreadFunc func, const char *name, void *data);
+
+// Wait for the thread to exit, free it and return its result
+int Platform_ThreadJoin(PlatformThread *thread);
+
+// Name the calling thread (threads started by Platform_ThreadCreate already have theirs).
+// Names may be truncated (15 characters on Linux).
+void Platform_ThreadSetName(const char *name);
+
+// Pin a thread (NULL = the calling thread) to the logical CPUs set in cpu_mask (bit n = CPU n).
+// Returns false where the OS or backend can't pin threads.
+bool Platform_ThreadSetAffinity(PlatformThread *thread, uint64_t cpu_mask);
+
+// Give up the rest of the time slice
+void Platform_ThreadYield(void);
+
+// Logical CPU cores available to the process (at least 1)
+uint32_t Platform_GetCPUCount(void);
+
+// ============================================================================
+// Mutexes and condition variables
+// ============================================================================
+
+// Non-recursive mutex
+PlatformMutex *Platform_MutexCreate(void);
+void Platform_MutexDestroy(PlatformMutex *mutex);
+void Platform_MutexLock(PlatformMutex *mutex);
+bool Platform_MutexTryLock(PlatformMutex *mutex);
+void Platform_MutexUnlock(PlatformMutex *mutex);
+
+// Waits may wake spuriously: always re-check the predicate in a loop
+PlatformCondition *Platform_ConditionCreate(void);
+void Platform_ConditionDestroy(PlatformCondition *condition);
+void Platform_ConditionWait(PlatformCondition *condition, PlatformMutex *mutex);
+// False if timeout_ns passed without a signal
+bool Platform_ConditionWaitTimeout(PlatformCondition *condition, PlatformMutex *mutex, uint64_t timeout_ns);
+void Platform_ConditionSignal(PlatformCondition *condition);
+void Platform_ConditionBroadcast(PlatformCondition *condition);
+
+// ============================================================================
+// Semaphores
+// ============================================================================
+
+// Counting semaphore
+PlatformSemaphore *Platform_SemaphoreCreate(uint32_t initial_count);
+void Platform_SemaphoreDestroy(PlatformSemaphore *semaphore);
+void Platform_SemaphoreWait(PlatformSemaphore *semaphore);
+bool Platform_SemaphoreTryWait(PlatformSemaphore *semaphore);
+void Platform_SemaphorePost(PlatformSemaphore *semaphore, uint32_t count);
+
+// ============================================================================
+// Address waits (futex-style)
+// ============================================================================
+
+// Sleep while *address == expected, until a wake on the address or timeout_ns. Lets a lock-free
+// structure block on one of its own words without a mutex. May return spuriously: re-check the
+// value. Returns false on timeout.
+bool Platform_WaitOnAddress(volatile uint32_t *address, uint32_t expected, uint64_t timeout_ns);
+
+// Wake one (or every) thread waiting on address. Change the value first.
+void Platform_WakeOnAddress(volatile uint32_t *address, bool wake_all);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -4,6 +4,7 @@
 #ifndef PLUGIN_API_H
 #define PLUGIN_API_H
 
+#include "arena_types.h"
 #include "platform_api_types.h"
 #include "engine_api_types.h"
 #include <stdbool.h>
@@ -36,6 +37,37 @@ typedef struct PluginAPI {
 
   // shutdown is responsible for cleanly shutting down and freeing its own state memory (state**).
   void (*shutdown)(void **state);
+
+  // resolve_extensions (optional) fills the plugin's cached extension API pointers. Called by the
+  // plugin manager before init and again after every reload (a reloaded image starts with an empty cache).
+  void (*resolve_extensions)(EngineAPI *engine);
+
+  // State layout (optional). Bump state_version whenever the state struct's layout changes. When a
+  // reload changes it, the manager allocates state_size zeroed bytes from the arena the old build's
+  // get_state_arena returns and calls the new build's migrate_state (old_state is still intact and
+  // stays allocated). Without these, or if migrate_state returns false, the plugin is restarted
+  // instead: the old build's shutdown, then the new build's init.
+  uint32_t state_version;
+  uint32_t state_size;
+  Arena *(*get_state_arena)(void *state);
+  bool (*migrate_state)(void *new_state, const void *old_state, uint32_t old_version);
+
+  // Update scheduling (optional). NULL-terminated lists of the resources update reads and writes:
+  // other plugins by name, or any shared data the plugins agree on a name for. A plugin always
+  // writes its own name. Plugins whose accesses don't conflict (nobody writes what the other
+  // touches) update at the same time on worker threads; conflicting ones update one after the
+  // other in load order. Leave both NULL to update alone, as before; an empty list opts in to
+  // running alongside everything else. render is never run concurrently.
+  const char *const *update_reads;
+  const char *const *update_writes;
+
+  // Pipelined frames (optional, see Engine_SetPipelined). snapshot copies whatever render needs out
+  // of state into frame_arena and returns it; it runs on the simulation thread after the frame's
+  // updates. render_snapshot then draws that copy on the main thread while the next frame's updates
+  // run, so it must not touch state. The frame arena is reset two frames later. Plugins without
+  // both keep the engine rendering in step with the simulation.
+  void *(*snapshot)(const void *state, Arena *frame_arena);
+  void (*render_snapshot)(const void *render_data);
 } PluginAPI;
 
 PLUGIN_EXPORT PluginAPI *GetPluginAPI(void);
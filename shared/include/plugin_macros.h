@@ -16,9 +16,25 @@ extern "C" {
 
 // Macro to define API accessor functions for a plugin
 // Usage: DEFINE_PLUGIN_API_ACCESSORS(g_my_plugin_state)
-#define DEFINE_PLUGIN_API_ACCESSORS(state_ptr)                                     \
-  static inline PlatformAPI *__platform_api(void) { return (state_ptr).platform; } \
-  static inline EngineAPI *__engine_api(void) { return (state_ptr).engine; }
+// Also defines __plugin_resolve_extensions: point the plugin's PluginAPI.resolve_extensions at it.
+#ifdef ENABLE_GAME_AS_PLUGIN
+// Hot reload: extension macros go through a cache of IDs resolved once per plugin image, each API
+// pointer fetched on first use (ExtensionAPICache is generated alongside the extension macros)
+#define DEFINE_PLUGIN_API_ACCESSORS(state_ptr)                                            \
+  static inline PlatformAPI *__platform_api(void) { return (state_ptr).platform; }        \
+  static inline EngineAPI *__engine_api(void) { return (state_ptr).engine; }              \
+  static ExtensionAPICache __extension_cache;                                             \
+  static inline ExtensionAPICache *__extension_api(void) { return &__extension_cache; }   \
+  static void __plugin_resolve_extensions(EngineAPI *engine) {                            \
+    ExtensionAPICache_Resolve(&__extension_cache, engine);                                \
+  }
+#else
+// Static: extension macros are direct calls, nothing to resolve
+#define DEFINE_PLUGIN_API_ACCESSORS(state_ptr)                                            \
+  static inline PlatformAPI *__platform_api(void) { return (state_ptr).platform; }        \
+  static inline EngineAPI *__engine_api(void) { return (state_ptr).engine; }              \
+  static void __plugin_resolve_extensions(EngineAPI *engine) { (void)engine; }
+#endif
 
 // Universal Platform Macros
 #ifdef ENABLE_GAME_AS_PLUGIN
@@ -29,6 +45,34 @@ extern "C" {
 #define PLATFORM_ALLOC(size) __platform_api()->Alloc(size)
 #define PLATFORM_FREE(ptr) __platform_api()->Free(ptr)
 #define PLATFORM_GET_TICKS_NS() __platform_api()->GetTicksNS()
+#define PLATFORM_SLEEP(ns) __platform_api()->Sleep(ns)
+#define PLATFORM_SLEEP_UNTIL(target_ns) __platform_api()->SleepUntil(target_ns)
+
+#define PLATFORM_THREAD_CREATE(func, name, data) __platform_api()->ThreadCreate(func, name, data)
+#define PLATFORM_THREAD_JOIN(thread) __platform_api()->ThreadJoin(thread)
+#define PLATFORM_THREAD_SET_NAME(name) __platform_api()->ThreadSetName(name)
+#define PLATFORM_THREAD_SET_AFFINITY(thread, mask) __platform_api()->ThreadSetAffinity(thread, mask)
+#define PLATFORM_THREAD_YIELD() __platform_api()->ThreadYield()
+#define PLATFORM_GET_THREAD_ID() __platform_api()->GetThreadID()
+#define PLATFORM_GET_CPU_COUNT() __platform_api()->GetCPUCount()
+#define PLATFORM_MUTEX_CREATE() __platform_api()->MutexCreate()
+#define PLATFORM_MUTEX_DESTROY(mutex) __platform_api()->MutexDestroy(mutex)
+#define PLATFORM_MUTEX_LOCK(mutex) __platform_api()->MutexLock(mutex)
+#define PLATFORM_MUTEX_TRY_LOCK(mutex) __platform_api()->MutexTryLock(mutex)
+#define PLATFORM_MUTEX_UNLOCK(mutex) __platform_api()->MutexUnlock(mutex)
+#define PLATFORM_CONDITION_CREATE() __platform_api()->ConditionCreate()
+#define PLATFORM_CONDITION_DESTROY(cond) __platform_api()->ConditionDestroy(cond)
+#define PLATFORM_CONDITION_WAIT(cond, mutex) __platform_api()->ConditionWait(cond, mutex)
+#define PLATFORM_CONDITION_WAIT_TIMEOUT(cond, mutex, ns) __platform_api()->ConditionWaitTimeout(cond, mutex, ns)
+#define PLATFORM_CONDITION_SIGNAL(cond) __platform_api()->ConditionSignal(cond)
+#define PLATFORM_CONDITION_BROADCAST(cond) __platform_api()->ConditionBroadcast(cond)
+#define PLATFORM_SEMAPHORE_CREATE(count) __platform_api()->SemaphoreCreate(count)
+#define PLATFORM_SEMAPHORE_DESTROY(sem) __platform_api()->SemaphoreDestroy(sem)
+#define PLATFORM_SEMAPHORE_WAIT(sem) __platform_api()->SemaphoreWait(sem)
+#define PLATFORM_SEMAPHORE_TRY_WAIT(sem) __platform_api()->SemaphoreTryWait(sem)
+#define PLATFORM_SEMAPHORE_POST(sem, count) __platform_api()->SemaphorePost(sem, count)
+#define PLATFORM_WAIT_ON_ADDRESS(address, expected, timeout_ns) __platform_api()->WaitOnAddress(address, expected, timeout_ns)
+#define PLATFORM_WAKE_ON_ADDRESS(address, wake_all) __platform_api()->WakeOnAddress(address, wake_all)
 
 #define PLATFORM_CREATE_WINDOW(...) __platform_api()->CreateWindow(__VA_ARGS__)
 #define PLATFORM_DESTROY_WINDOW(w) __platform_api()->DestroyWindow(w)
@@ -49,20 +93,58 @@ extern "C" {
 
 #define PLATFORM_GET_ROOT_ARENA() __platform_api()->GetRootArena()
 #define ARENA_CREATE_BUMP(parent, size, align) __platform_api()->ArenaCreateBump(parent, size, align)
+#define ARENA_CREATE_CONCURRENT_BUMP(parent, size, align) __platform_api()->ArenaCreateConcurrentBump(parent, size, align)
 #define ARENA_CREATE_STACK(parent, size, align) __platform_api()->ArenaCreateStack(parent, size, align)
 #define ARENA_CREATE_BLOCK(parent, block_size, count, align) __platform_api()->ArenaCreateBlock(parent, block_size, count, align)
+#define ARENA_CREATE_MULTI_POOL(parent, total_size) __platform_api()->ArenaCreateMultiPool(parent, total_size)
+#define ARENA_CREATE_SCRATCH(parent, size, align) __platform_api()->ArenaCreateScratch(parent, size, align)
 #define ARENA_ALLOC(arena, size) __platform_api()->ArenaAlloc(arena, size)
 #define ARENA_ALLOC_ALIGNED(arena, size, align) __platform_api()->ArenaAllocAligned(arena, size, align)
+// Inline pushes need the arena code in the same image; plugins take the API call
+#define ARENA_BUMP_PUSH(arena, size, align) __platform_api()->ArenaAllocAligned(arena, size, align)
+#define ARENA_STACK_PUSH(arena, size, align) __platform_api()->ArenaAllocAligned(arena, size, align)
+#define ARENA_FREE(arena, ptr) __platform_api()->ArenaFree(arena, ptr)
+#define ARENA_TRY_EXTEND(arena, ptr, old_size, new_size) __platform_api()->ArenaTryExtend(arena, ptr, old_size, new_size)
+#define ARENA_REALLOC(arena, ptr, old_size, new_size, align) __platform_api()->ArenaRealloc(arena, ptr, old_size, new_size, align)
 #define ARENA_RESET(arena) __platform_api()->ArenaReset(arena)
 #define ARENA_DESTROY(arena) __platform_api()->ArenaDestroy(arena)
 #define ARENA_SET_DEBUG_NAME(arena, name) __platform_api()->ArenaSetDebugName(arena, name)
 #define ARENA_GET_CAPACITY(arena) __platform_api()->ArenaGetCapacity(arena)
 #define ARENA_GET_USED(arena) __platform_api()->ArenaGetUsed(arena)
+#define ARENA_GET_PEAK_USED(arena) __platform_api()->ArenaGetPeakUsed(arena)
+#define ARENA_BEGIN_TEMP(arena) __platform_api()->ArenaBeginTemp(arena)
+#define ARENA_END_TEMP(temp) __platform_api()->ArenaEndTemp(temp)
+#define ARENA_GET_THREAD_SCRATCH(conflicts, count) __platform_api()->ArenaGetThreadScratch(conflicts, count)
+#define ARENA_RELEASE_THREAD_SCRATCH() __platform_api()->ArenaReleaseThreadScratch()
+#define ARENA_DUMP_HIERARCHY(root, path, format) __platform_api()->ArenaDumpHierarchy(root, path, format)
+#define ARENA_TRACE_GET_EVENTS(events, max) __platform_api()->ArenaTraceGetEvents(events, max)
+
+#define ARENA_ARRAY_CREATE(arena, elem_size, align, capacity) __platform_api()->ArenaArrayCreate(arena, elem_size, align, capacity)
+#define ARENA_ARRAY_RESERVE(array, capacity) __platform_api()->ArenaArrayReserve(array, capacity)
+#define ARENA_ARRAY_PUSH(array) __platform_api()->ArenaArrayPush(array)
+#define ARENA_ARRAY_PUSH_N(array, count) __platform_api()->ArenaArrayPushN(array, count)
+#define ARENA_ARRAY_CLEAR(array) __platform_api()->ArenaArrayClear(array)
+#define ARENA_STRING_CREATE(arena, capacity) __platform_api()->ArenaStringCreate(arena, capacity)
+#define ARENA_STRING_APPEND(string, str, len) __platform_api()->ArenaStringAppend(string, str, len)
+#define ARENA_STRING_APPEND_CSTR(string, str) __platform_api()->ArenaStringAppendCStr(string, str)
+#define ARENA_STRING_APPENDF(...) __platform_api()->ArenaStringAppendf(__VA_ARGS__)
+#define ARENA_STRING_CLEAR(string) __platform_api()->ArenaStringClear(string)
+
+#define HANDLE_ARENA_CREATE(parent, heap_size, max_handles) __platform_api()->HandleArenaCreate(parent, heap_size, max_handles)
+#define HANDLE_ARENA_DESTROY(handles) __platform_api()->HandleArenaDestroy(handles)
+#define HANDLE_ARENA_ALLOC(handles, size) __platform_api()->HandleArenaAlloc(handles, size)
+#define HANDLE_ARENA_FREE(handles, handle) __platform_api()->HandleArenaFree(handles, handle)
+#define HANDLE_ARENA_PIN(handles, handle) __platform_api()->HandleArenaPin(handles, handle)
+#define HANDLE_ARENA_UNPIN(handles, handle) __platform_api()->HandleArenaUnpin(handles, handle)
+#define HANDLE_ARENA_COMPACT(handles, max_bytes) __platform_api()->HandleArenaCompact(handles, max_bytes)
+// Resolve is inline (reads the handle table directly), so plugins call it without the API hop
+#define HANDLE_ARENA_RESOLVE HandleArena_Resolve
 
 #else
 // Static build: direct function calls (zero overhead!)
 #include "platform.h"
 #include "platform_renderer.h"
+#include "platform_thread.h"
 #include "platform_window.h"
 #include "engine.h"  // When you have engine functions
 
@@ -72,6 +154,34 @@ extern "C" {
 #define PLATFORM_ALLOC Platform_Alloc
 #define PLATFORM_FREE Platform_Free
 #define PLATFORM_GET_TICKS_NS Platform_GetTicksNS
+#define PLATFORM_SLEEP Platform_Sleep
+#define PLATFORM_SLEEP_UNTIL Platform_SleepUntil
+
+#define PLATFORM_THREAD_CREATE Platform_ThreadCreate
+#define PLATFORM_THREAD_JOIN Platform_ThreadJoin
+#define PLATFORM_THREAD_SET_NAME Platform_ThreadSetName
+#define PLATFORM_THREAD_SET_AFFINITY Platform_ThreadSetAffinity
+#define PLATFORM_THREAD_YIELD Platform_ThreadYield
+#define PLATFORM_GET_THREAD_ID Platform_GetThreadID
+#define PLATFORM_GET_CPU_COUNT Platform_GetCPUCount
+#define PLATFORM_MUTEX_CREATE Platform_MutexCreate
+#define PLATFORM_MUTEX_DESTROY Platform_MutexDestroy
+#define PLATFORM_MUTEX_LOCK Platform_MutexLock
+#define PLATFORM_MUTEX_TRY_LOCK Platform_MutexTryLock
+#define PLATFORM_MUTEX_UNLOCK Platform_MutexUnlock
+#define PLATFORM_CONDITION_CREATE Platform_ConditionCreate
+#define PLATFORM_CONDITION_DESTROY Platform_ConditionDestroy
+#define PLATFORM_CONDITION_WAIT Platform_ConditionWait
+#define PLATFORM_CONDITION_WAIT_TIMEOUT Platform_ConditionWaitTimeout
+#define PLATFORM_CONDITION_SIGNAL Platform_ConditionSignal
+#define PLATFORM_CONDITION_BROADCAST Platform_ConditionBroadcast
+#define PLATFORM_SEMAPHORE_CREATE Platform_SemaphoreCreate
+#define PLATFORM_SEMAPHORE_DESTROY Platform_SemaphoreDestroy
+#define PLATFORM_SEMAPHORE_WAIT Platform_SemaphoreWait
+#define PLATFORM_SEMAPHORE_TRY_WAIT Platform_SemaphoreTryWait
+#define PLATFORM_SEMAPHORE_POST Platform_SemaphorePost
+#define PLATFORM_WAIT_ON_ADDRESS Platform_WaitOnAddress
+#define PLATFORM_WAKE_ON_ADDRESS Platform_WakeOnAddress
 
 #define PLATFORM_CREATE_WINDOW Platform_CreateWindow
 #define PLATFORM_DESTROY_WINDOW Platform_DestroyWindow
@@ -92,15 +202,50 @@ extern "C" {
 
 #define PLATFORM_GET_ROOT_ARENA() Platform_GetRootArena()
 #define ARENA_CREATE_BUMP Arena_CreateBump
+#define ARENA_CREATE_CONCURRENT_BUMP Arena_CreateConcurrentBump
 #define ARENA_CREATE_STACK Arena_CreateStack
 #define ARENA_CREATE_BLOCK Arena_CreateBlock
+#define ARENA_CREATE_MULTI_POOL Arena_CreateMultiPool
+#define ARENA_CREATE_SCRATCH Arena_CreateScratch
 #define ARENA_ALLOC Arena_Alloc
 #define ARENA_ALLOC_ALIGNED Arena_AllocAligned
+#define ARENA_BUMP_PUSH Arena_BumpPush
+#define ARENA_STACK_PUSH Arena_StackPush
+#define ARENA_FREE Arena_Free
+#define ARENA_TRY_EXTEND Arena_TryExtend
+#define ARENA_REALLOC Arena_Realloc
 #define ARENA_RESET Arena_Reset
 #define ARENA_DESTROY Arena_Destroy
 #define ARENA_SET_DEBUG_NAME Arena_SetDebugName
 #define ARENA_GET_CAPACITY Arena_GetCapacity
 #define ARENA_GET_USED Arena_GetUsed
+#define ARENA_GET_PEAK_USED Arena_GetPeakUsed
+#define ARENA_BEGIN_TEMP Arena_BeginTemp
+#define ARENA_END_TEMP Arena_EndTemp
+#define ARENA_GET_THREAD_SCRATCH Arena_GetThreadScratch
+#define ARENA_RELEASE_THREAD_SCRATCH() Arena_ReleaseThreadScratch()
+#define ARENA_DUMP_HIERARCHY Arena_DumpHierarchy
+#define ARENA_TRACE_GET_EVENTS Arena_TraceGetEvents
+
+#define ARENA_ARRAY_CREATE ArenaArray_Create
+#define ARENA_ARRAY_RESERVE ArenaArray_Reserve
+#define ARENA_ARRAY_PUSH ArenaArray_Push
+#define ARENA_ARRAY_PUSH_N ArenaArray_PushN
+#define ARENA_ARRAY_CLEAR ArenaArray_Clear
+#define ARENA_STRING_CREATE ArenaString_Create
+#define ARENA_STRING_APPEND ArenaString_Append
+#define ARENA_STRING_APPEND_CSTR ArenaString_AppendCStr
+#define ARENA_STRING_APPENDF ArenaString_Appendf
+#define ARENA_STRING_CLEAR ArenaString_Clear
+
+#define HANDLE_ARENA_CREATE HandleArena_Create
+#define HANDLE_ARENA_DESTROY HandleArena_Destroy
+#define HANDLE_ARENA_ALLOC HandleArena_Alloc
+#define HANDLE_ARENA_FREE HandleArena_Free
+#define HANDLE_ARENA_PIN HandleArena_Pin
+#define HANDLE_ARENA_UNPIN HandleArena_Unpin
+#define HANDLE_ARENA_COMPACT HandleArena_Compact
+#define HANDLE_ARENA_RESOLVE HandleArena_Resolve
 
 #endif
 
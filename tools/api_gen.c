@@ -16,6 +16,7 @@
 #define MAX_LINE 2048
 #define MAX_FUNCTIONS 512
 #define MAX_NAME 256
+#define MAX_INCLUDES 16
 
 typedef struct {
   char return_type[MAX_NAME];
@@ -31,6 +32,8 @@ typedef struct {
   char extension_name[MAX_NAME]; // "Test", "SDL", etc.
   FunctionDecl functions[MAX_FUNCTIONS];
   int function_count;
+  char includes[MAX_INCLUDES][MAX_NAME]; // Shared type headers the API uses: "jobs_types.h"
+  int include_count;
 } ExtensionAPI;
 
 // Trim whitespace
@@ -135,6 +138,32 @@ int parse_function_decl(const char *line, FunctionDecl *func) {
   return 1;
 }
 
+// Remember an #include "xxx_types.h" so the generated header can declare the API's parameter types
+void record_types_include(const char *line, ExtensionAPI *api) {
+  const char *start = strchr(line, '"');
+  if (!start)
+    return;
+  start++;
+  const char *end = strchr(start, '"');
+  if (!end || end - start < 8 || strncmp(end - 8, "_types.h", 8) != 0)
+    return;
+
+  size_t len = (size_t)(end - start);
+  if (len >= MAX_NAME)
+    return;
+
+  for (int i = 0; i < api->include_count; i++) {
+    if (strlen(api->includes[i]) == len && strncmp(api->includes[i], start, len) == 0)
+      return;
+  }
+
+  if (api->include_count < MAX_INCLUDES) {
+    memcpy(api->includes[api->include_count], start, len);
+    api->includes[api->include_count][len] = '\0';
+    api->include_count++;
+  }
+}
+
 // Scan a source file for EXTENSION_API functions
 int scan_source_file(const char *filepath, ExtensionAPI *api, const char *filename) {
   FILE *file = fopen(filepath, "r");
@@ -150,6 +179,12 @@ int scan_source_file(const char *filepath, ExtensionAPI *api, const char *filena
   while (fgets(line, sizeof(line), file)) {
     line_num++;
 
+    // Parameter types come from shared *_types.h headers (jobs_types.h, arena_types.h, ...)
+    if (strncmp(line, "#include", 8) == 0) {
+      record_types_include(line, api);
+      continue;
+    }
+
     // Only look for EXTENSION_API marker
     if (!strstr(line, "EXTENSION_API"))
       continue;
@@ -255,7 +290,11 @@ void generate_api_header(ExtensionAPI *api, const char *output_path) {
   fprintf(out, "#define %s\n\n", guard);
 
   fprintf(out, "#include <stdbool.h>\n");
-  fprintf(out, "#include <stdint.h>\n\n");
+  fprintf(out, "#include <stdint.h>\n");
+  for (int i = 0; i < api->include_count; i++) {
+    fprintf(out, "#include \"%s\"\n", api->includes[i]);
+  }
+  fprintf(out, "\n");
 
   fprintf(out, "#ifdef __cplusplus\n");
   fprintf(out, "extern \"C\" {\n");
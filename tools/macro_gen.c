@@ -20,6 +20,7 @@
 #define MAX_LINE 1024
 #define MAX_FUNCTIONS 256
 #define MAX_NAME 128
+#define MAX_EXTENSIONS 64
 
 typedef struct {
     char name[MAX_NAME];           // Function name: "LogHello"
@@ -34,6 +35,15 @@ typedef struct {
     int function_count;
 } ExtensionInfo;
 
+// Every extension seen, for the hot-reload API cache
+typedef struct {
+    char api_name[MAX_NAME];
+    char ext_name[MAX_NAME];
+} CachedExtension;
+
+static CachedExtension g_cached_extensions[MAX_EXTENSIONS];
+static int g_cached_extension_count = 0;
+
 // Convert CamelCase to SNAKE_CASE
 void camel_to_snake_upper(const char* input, char* output) {
     int j = 0;
@@ -187,6 +197,14 @@ int parse_api_header(const char* filepath, ExtensionInfo* ext) {
 
 // Generate macros for one extension
 void generate_extension_macros(FILE* out_hot, FILE* out_static, ExtensionInfo* ext) {
+    if (g_cached_extension_count >= MAX_EXTENSIONS) {
+        fprintf(stderr, "Too many extension APIs (max %d), skipping %s\n", MAX_EXTENSIONS, ext->api_name);
+        return;
+    }
+    CachedExtension* cached = &g_cached_extensions[g_cached_extension_count++];
+    strcpy(cached->api_name, ext->api_name);
+    strcpy(cached->ext_name, ext->ext_name);
+
     fprintf(out_hot, "// %s Extension Macros\n", ext->ext_name);
     fprintf(out_static, "// %s Extension Macros\n", ext->ext_name);
 
@@ -209,8 +227,8 @@ void generate_extension_macros(FILE* out_hot, FILE* out_static, ExtensionInfo* e
 
         // Hot reload macro
         fprintf(out_hot, "#define %s(...) \\\n", macro_name);
-        fprintf(out_hot, "    ((%s*)__engine_api()->GetExtensionAPI(\"%s\"))->%s(__VA_ARGS__)\n",
-                ext->api_name, ext->ext_name, func->name);
+        fprintf(out_hot, "    ExtensionAPICache_Get%s(__extension_api())->%s(__VA_ARGS__)\n",
+                ext->ext_name, func->name);
 
         // Static macro
         fprintf(out_static, "#define %s %s_%s\n",
@@ -221,6 +239,44 @@ void generate_extension_macros(FILE* out_hot, FILE* out_static, ExtensionInfo* e
     fprintf(out_static, "\n");
 }
 
+// Hot-reload extension API cache: one ID and one pointer per extension. The IDs are resolved by
+// name once per plugin image (DEFINE_PLUGIN_API_ACCESSORS / PluginAPI.resolve_extensions); each
+// pointer is fetched by ID on its first macro call, so resolving never initialises a lazy extension.
+void generate_extension_cache(FILE* out) {
+    fprintf(out, "// Extension API cache: IDs resolved at plugin init and after every hot reload, API\n");
+    fprintf(out, "// pointers fetched on first use (which is when a lazy extension initialises)\n");
+    fprintf(out, "typedef struct ExtensionAPICache {\n");
+    fprintf(out, "    EngineAPI* engine;\n");
+    for (int i = 0; i < g_cached_extension_count; i++) {
+        fprintf(out, "    ExtensionID %s_id;\n", g_cached_extensions[i].ext_name);
+        fprintf(out, "    volatile size_t %s; // struct %s*, 0 until first use\n",
+                g_cached_extensions[i].ext_name, g_cached_extensions[i].api_name);
+    }
+    fprintf(out, "} ExtensionAPICache;\n\n");
+
+    fprintf(out, "static inline void ExtensionAPICache_Resolve(ExtensionAPICache* cache, EngineAPI* engine) {\n");
+    fprintf(out, "    cache->engine = engine;\n");
+    for (int i = 0; i < g_cached_extension_count; i++) {
+        fprintf(out, "    cache->%s_id = engine->GetExtensionID(\"%s\");\n",
+                g_cached_extensions[i].ext_name, g_cached_extensions[i].ext_name);
+        fprintf(out, "    Platform_AtomicStoreSize(&cache->%s, 0);\n", g_cached_extensions[i].ext_name);
+    }
+    fprintf(out, "}\n\n");
+
+    for (int i = 0; i < g_cached_extension_count; i++) {
+        const char* ext = g_cached_extensions[i].ext_name;
+        const char* api = g_cached_extensions[i].api_name;
+        fprintf(out, "static inline struct %s* ExtensionAPICache_Get%s(ExtensionAPICache* cache) {\n", api, ext);
+        fprintf(out, "    size_t api = Platform_AtomicLoadSize(&cache->%s);\n", ext);
+        fprintf(out, "    if (!api) {\n");
+        fprintf(out, "        api = (size_t)cache->engine->GetExtensionAPIByID(cache->%s_id);\n", ext);
+        fprintf(out, "        Platform_AtomicStoreSize(&cache->%s, api);\n", ext);
+        fprintf(out, "    }\n");
+        fprintf(out, "    return (struct %s*)api;\n", api);
+        fprintf(out, "}\n\n");
+    }
+}
+
 // Platform-agnostic directory iteration
 #ifdef _WIN32
 int iterate_directory(const char* shared_dir, FILE* temp_hot, FILE* temp_static,
@@ -363,6 +419,9 @@ int main(int argc, char** argv) {
     fprintf(out, "#ifndef PLUGIN_MACROS_GENERATED_H\n");
     fprintf(out, "#define PLUGIN_MACROS_GENERATED_H\n\n");
     fprintf(out, "#ifdef ENABLE_GAME_AS_PLUGIN\n\n");
+    fprintf(out, "#include \"platform_atomic.h\"\n\n");
+
+    generate_extension_cache(out);
 
     // Copy hot-reload macros
     rewind(temp_hot);
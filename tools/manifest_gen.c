@@ -0,0 +1,517 @@
+// Copyright (c) 2025 Andrew Carroll Games, LLC
+// Extension manifest generator - scans extension sources for their ExtensionInterface definitions
+// and generates the engine's extension manifest (compile-time IDs and count) and its static
+// extension dispatch (direct calls, no table walk)
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LINE 2048
+#define MAX_EXTENSIONS 256
+#define MAX_NAME 256
+
+// Must match ExtensionPhase / ExtensionUpdateRate in extension.h
+static const char *g_phase_names[] = {
+    "EXTENSION_PHASE_POST_GAME",
+    "EXTENSION_PHASE_PRE_GAME",
+    "EXTENSION_PHASE_PRE_RENDER",
+};
+static const char *g_phase_functions[] = {
+    "ExtensionDispatch_PostGame",
+    "ExtensionDispatch_PreGame",
+    "ExtensionDispatch_PreRender",
+};
+#define PHASE_COUNT (int)(sizeof(g_phase_names) / sizeof(g_phase_names[0]))
+
+static const char *g_rate_names[] = {
+    "EXTENSION_UPDATE_EVERY_FRAME",
+    "EXTENSION_UPDATE_EVERY_N_FRAMES",
+    "EXTENSION_UPDATE_FIXED_STEP",
+};
+#define RATE_COUNT (int)(sizeof(g_rate_names) / sizeof(g_rate_names[0]))
+
+typedef struct {
+  char variable[MAX_NAME]; // "g_extension_test"
+  char name[MAX_NAME];     // .name as written, without quotes: "Test"
+  char id[MAX_NAME];       // Generated ExtensionID constant: "EXTENSION_ID_TEST"
+  char update[MAX_NAME];   // Update function as written: "Test_Update" (empty = none)
+  int update_is_static;    // Defined static in its file: call through the interface instead
+  int phase;               // Index into g_phase_names
+  int rate;                // Index into g_rate_names
+  int lazy;                // .lazy = true: the update waits until the extension has been initialised
+  char source[MAX_LINE];
+  int line_number;
+} ExtensionDecl;
+
+static ExtensionDecl g_extensions[MAX_EXTENSIONS];
+static int g_extension_count = 0;
+
+// Trim whitespace
+void trim(char *str) {
+  char *start = str;
+  while (isspace((unsigned char)*start))
+    start++;
+  if (start != str)
+    memmove(str, start, strlen(start) + 1);
+  if (*str == 0)
+    return;
+  char *end = str + strlen(str) - 1;
+  while (end > str && isspace((unsigned char)*end))
+    end--;
+  *(end + 1) = 0;
+}
+
+static int is_identifier(const char *str) {
+  if (!*str || isdigit((unsigned char)*str))
+    return 0;
+  for (; *str; str++) {
+    if (!isalnum((unsigned char)*str) && *str != '_')
+      return 0;
+  }
+  return 1;
+}
+
+static int find_name(const char **names, int count, const char *value) {
+  for (int i = 0; i < count; i++) {
+    if (strcmp(names[i], value) == 0)
+      return i;
+  }
+  return -1;
+}
+
+static void fail(const ExtensionDecl *ext, const char *message, const char *value) {
+  fprintf(stderr, "\n");
+  fprintf(stderr, "========================================\n");
+  fprintf(stderr, "ERROR: %s\n", message);
+  fprintf(stderr, "========================================\n");
+  fprintf(stderr, "File: %s\n", ext->source);
+  fprintf(stderr, "Line: %d\n", ext->line_number);
+  fprintf(stderr, "Extension: %s\n", ext->variable);
+  fprintf(stderr, "Value: %s\n", value);
+  fprintf(stderr, "\n");
+  fprintf(stderr, "phase and update_rate must be written as one of the\n");
+  fprintf(stderr, "EXTENSION_PHASE_* / EXTENSION_UPDATE_* names, and lazy\n");
+  fprintf(stderr, "as true or false, so the dispatch can be generated at\n");
+  fprintf(stderr, "build time.\n");
+  fprintf(stderr, "========================================\n");
+  exit(1);
+}
+
+// Parse one ".field = value," line of an ExtensionInterface initializer
+static void parse_field(char *line, ExtensionDecl *ext) {
+  char *dot = strchr(line, '.');
+  char *equals = strchr(line, '=');
+  if (!dot || !equals || equals < dot)
+    return;
+
+  *equals = '\0';
+  char field[MAX_NAME];
+  snprintf(field, sizeof(field), "%s", dot + 1);
+  trim(field);
+
+  char value[MAX_LINE];
+  snprintf(value, sizeof(value), "%s", equals + 1);
+  char *comma = strchr(value, ',');
+  if (comma)
+    *comma = '\0';
+  char *comment = strstr(value, "//");
+  if (comment)
+    *comment = '\0';
+  trim(value);
+
+  if (strcmp(field, "name") == 0) {
+    char *open = strchr(value, '"');
+    char *close = open ? strchr(open + 1, '"') : NULL;
+    if (close) {
+      snprintf(ext->name, sizeof(ext->name), "%.*s", (int)(close - open - 1), open + 1);
+    }
+  } else if (strcmp(field, "Update") == 0) {
+    snprintf(ext->update, sizeof(ext->update), "%.255s", strcmp(value, "NULL") == 0 ? "" : value);
+  } else if (strcmp(field, "phase") == 0) {
+    ext->phase = find_name(g_phase_names, PHASE_COUNT, value);
+    if (ext->phase < 0)
+      fail(ext, "Unknown extension phase", value);
+  } else if (strcmp(field, "update_rate") == 0) {
+    ext->rate = find_name(g_rate_names, RATE_COUNT, value);
+    if (ext->rate < 0)
+      fail(ext, "Unknown extension update rate", value);
+  } else if (strcmp(field, "lazy") == 0) {
+    if (strcmp(value, "true") != 0 && strcmp(value, "false") != 0)
+      fail(ext, "Extension lazy flag isn't a literal", value);
+    ext->lazy = strcmp(value, "true") == 0;
+  }
+}
+
+// Is function defined with internal linkage somewhere in the file?
+static int is_static_function(const char *filepath, const char *function) {
+  FILE *file = fopen(filepath, "r");
+  if (!file)
+    return 0;
+
+  char line[MAX_LINE];
+  int result = 0;
+  size_t len = strlen(function);
+  while (!result && fgets(line, sizeof(line), file)) {
+    char *name = strstr(line, function);
+    if (!name || strncmp(line, "static", 6) != 0)
+      continue;
+    char *after = name + len;
+    while (isspace((unsigned char)*after))
+      after++;
+    result = *after == '(';
+  }
+
+  fclose(file);
+  return result;
+}
+
+// Scan a source file for "ExtensionInterface g_extension_xxx = {" definitions
+int scan_source_file(const char *filepath) {
+  FILE *file = fopen(filepath, "r");
+  if (!file) {
+    fprintf(stderr, "Warning: Could not open %s\n", filepath);
+    return 0;
+  }
+
+  char line[MAX_LINE];
+  int line_num = 0;
+  int found = 0;
+  ExtensionDecl *ext = NULL;
+
+  while (fgets(line, sizeof(line), file)) {
+    line_num++;
+
+    if (ext) {
+      if (strstr(line, "};")) {
+        if (ext->update[0] && is_identifier(ext->update)) {
+          ext->update_is_static = is_static_function(filepath, ext->update);
+        }
+        ext = NULL;
+        found++;
+        continue;
+      }
+      parse_field(line, ext);
+      continue;
+    }
+
+    char *type = strstr(line, "ExtensionInterface");
+    if (!type || !strchr(line, '=') || !strchr(line, '{') || strstr(line, "typedef"))
+      continue;
+
+    if (g_extension_count >= MAX_EXTENSIONS) {
+      fprintf(stderr, "Warning: Maximum extensions (%d) reached, skipping %s\n", MAX_EXTENSIONS, filepath);
+      break;
+    }
+
+    ext = &g_extensions[g_extension_count++];
+    memset(ext, 0, sizeof(*ext));
+    snprintf(ext->source, sizeof(ext->source), "%s", filepath);
+    ext->line_number = line_num;
+
+    // Variable name: the identifier between the type and '='
+    char *name = type + strlen("ExtensionInterface");
+    while (isspace((unsigned char)*name))
+      name++;
+    char *end = name;
+    while (isalnum((unsigned char)*end) || *end == '_')
+      end++;
+    snprintf(ext->variable, sizeof(ext->variable), "%.*s", (int)(end - name), name);
+  }
+
+  fclose(file);
+  return found;
+}
+
+// EXTENSION_ID_<NAME>, from .name ("Renderer2D" -> EXTENSION_ID_RENDERER2D), or the variable
+// name without its g_extension_ prefix when .name isn't a literal
+static void build_id(ExtensionDecl *ext) {
+  const char *source = ext->name;
+  if (!source[0]) {
+    source = strncmp(ext->variable, "g_extension_", 12) == 0 ? ext->variable + 12 : ext->variable;
+  }
+
+  char *out = ext->id + sprintf(ext->id, "EXTENSION_ID_");
+  for (; *source && out < ext->id + sizeof(ext->id) - 1; source++) {
+    *out++ = isalnum((unsigned char)*source) ? (char)toupper((unsigned char)*source) : '_';
+  }
+  *out = '\0';
+}
+
+static int compare_extensions(const void *a, const void *b) {
+  return strcmp(((const ExtensionDecl *)a)->variable, ((const ExtensionDecl *)b)->variable);
+}
+
+// Prefix for the generated rate state: g_extension_test -> s_extension_test_*
+static const char *state_name(const ExtensionDecl *ext) {
+  return strncmp(ext->variable, "g_", 2) == 0 ? ext->variable + 2 : ext->variable;
+}
+
+// One update call, through the function itself whenever it can be named from here
+static void write_update_call(FILE *out, const ExtensionDecl *ext, const char *indent, const char *dt) {
+  if (is_identifier(ext->update) && !ext->update_is_static) {
+    fprintf(out, "%s%s(%s);\n", indent, ext->update, dt);
+  } else {
+    fprintf(out, "%s%s.Update(%s);\n", indent, ext->variable, dt);
+  }
+}
+
+// Generate the manifest header: IDs, count and the X-macro list the engine builds its array from
+int generate_manifest_header(const char *output_path) {
+  FILE *out = fopen(output_path, "w");
+  if (!out) {
+    fprintf(stderr, "Error: Could not open output file: %s\n", output_path);
+    return 0;
+  }
+
+  fprintf(out, "// Auto-generated - do not edit\n");
+  fprintf(out, "// Generated from extension interface definitions\n");
+  fprintf(out, "// Extensions: %d\n\n", g_extension_count);
+  fprintf(out, "#ifndef EXTENSION_MANIFEST_GENERATED_H\n");
+  fprintf(out, "#define EXTENSION_MANIFEST_GENERATED_H\n\n");
+  fprintf(out, "#include \"extension.h\"\n\n");
+
+  if (g_extension_count) {
+    fprintf(out, "// Compile-time ExtensionIDs: index into the manifest, in registration order\n");
+    fprintf(out, "enum {\n");
+    for (int i = 0; i < g_extension_count; i++) {
+      fprintf(out, "  %s = %d, // %s\n", g_extensions[i].id, i, g_extensions[i].variable);
+    }
+    fprintf(out, "};\n\n");
+  }
+
+  fprintf(out, "#define EXTENSION_COUNT %d\n\n", g_extension_count);
+
+  fprintf(out, "// X(id, interface) for every extension, in registration order\n");
+  fprintf(out, "#define EXTENSION_MANIFEST(X)");
+  for (int i = 0; i < g_extension_count; i++) {
+    fprintf(out, " \\\n  X(%s, %s)", g_extensions[i].id, g_extensions[i].variable);
+  }
+  fprintf(out, "\n\n");
+
+  for (int i = 0; i < g_extension_count; i++) {
+    fprintf(out, "extern ExtensionInterface %s;\n", g_extensions[i].variable);
+  }
+  if (g_extension_count) {
+    fprintf(out, "\n");
+  }
+
+  fprintf(out, "#endif // EXTENSION_MANIFEST_GENERATED_H\n");
+  fclose(out);
+  return 1;
+}
+
+// Generate the dispatch header
+int generate_dispatch_header(const char *output_path) {
+  FILE *out = fopen(output_path, "w");
+  if (!out) {
+    fprintf(stderr, "Error: Could not open output file: %s\n", output_path);
+    return 0;
+  }
+
+  int update_count = 0;
+  for (int i = 0; i < g_extension_count; i++) {
+    update_count += g_extensions[i].update[0] != '\0';
+  }
+
+  fprintf(out, "// Auto-generated - do not edit\n");
+  fprintf(out, "// Generated from extension interface definitions\n");
+  fprintf(out, "// Extensions: %d, Update callbacks: %d\n\n", g_extension_count, update_count);
+  fprintf(out, "#ifndef EXTENSION_DISPATCH_GENERATED_H\n");
+  fprintf(out, "#define EXTENSION_DISPATCH_GENERATED_H\n\n");
+  fprintf(out, "// Included by engine.c, which provides Engine_IsExtensionReady for lazy extensions\n");
+  fprintf(out, "#include \"extension.h\"\n");
+  fprintf(out, "#include \"extension_manifest_generated.h\"\n\n");
+
+  // Declarations
+  for (int i = 0; i < g_extension_count; i++) {
+    const ExtensionDecl *ext = &g_extensions[i];
+    fprintf(out, "extern ExtensionInterface %s;\n", ext->variable);
+    if (is_identifier(ext->update) && !ext->update_is_static) {
+      fprintf(out, "void %s(float dt);\n", ext->update);
+    }
+  }
+  fprintf(out, "\n");
+
+  // Per-extension rate state
+  for (int i = 0; i < g_extension_count; i++) {
+    const ExtensionDecl *ext = &g_extensions[i];
+    if (!ext->update[0])
+      continue;
+    if (strcmp(g_rate_names[ext->rate], "EXTENSION_UPDATE_EVERY_N_FRAMES") == 0) {
+      fprintf(out, "static uint32_t s_%s_frames;\n", state_name(ext));
+      fprintf(out, "static float s_%s_elapsed;\n", state_name(ext));
+    } else if (strcmp(g_rate_names[ext->rate], "EXTENSION_UPDATE_FIXED_STEP") == 0) {
+      fprintf(out, "static float s_%s_accumulator;\n", state_name(ext));
+    }
+  }
+  fprintf(out, "\n");
+
+  // One function per phase: the update calls in registration (manifest) order
+  for (int phase = 0; phase < PHASE_COUNT; phase++) {
+    fprintf(out, "static inline void %s(float dt) {\n", g_phase_functions[phase]);
+    fprintf(out, "  (void)dt;\n");
+
+    for (int i = 0; i < g_extension_count; i++) {
+      const ExtensionDecl *ext = &g_extensions[i];
+      if (!ext->update[0] || ext->phase != phase)
+        continue;
+
+      // Lazy extensions skip their update until a lookup has initialised them
+      const char *pad = ext->lazy ? "  " : "";
+      if (ext->lazy) {
+        fprintf(out, "  if (Engine_IsExtensionReady(%s)) {\n", ext->id);
+      }
+
+      char indent[16];
+      const char *rate = g_rate_names[ext->rate];
+      if (strcmp(rate, "EXTENSION_UPDATE_EVERY_N_FRAMES") == 0) {
+        fprintf(out, "%s  s_%s_elapsed += dt;\n", pad, state_name(ext));
+        fprintf(out, "%s  if (++s_%s_frames >= %s.update_interval) {\n", pad, state_name(ext), ext->variable);
+        char dt_expr[MAX_LINE];
+        snprintf(dt_expr, sizeof(dt_expr), "s_%.255s_elapsed", state_name(ext));
+        snprintf(indent, sizeof(indent), "%s    ", pad);
+        write_update_call(out, ext, indent, dt_expr);
+        fprintf(out, "%s    s_%s_frames = 0;\n", pad, state_name(ext));
+        fprintf(out, "%s    s_%s_elapsed = 0.0f;\n", pad, state_name(ext));
+        fprintf(out, "%s  }\n", pad);
+      } else if (strcmp(rate, "EXTENSION_UPDATE_FIXED_STEP") == 0) {
+        fprintf(out, "%s  {\n", pad);
+        fprintf(out, "%s    const float step = %s.update_step;\n", pad, ext->variable);
+        fprintf(out, "%s    const float max_backlog = step * EXTENSION_MAX_CATCHUP_STEPS;\n", pad);
+        fprintf(out, "%s    s_%s_accumulator += dt;\n", pad, state_name(ext));
+        fprintf(out, "%s    if (s_%s_accumulator > max_backlog) s_%s_accumulator = max_backlog;\n",
+                pad, state_name(ext), state_name(ext));
+        fprintf(out, "%s    while (step > 0.0f && s_%s_accumulator >= step) {\n", pad, state_name(ext));
+        snprintf(indent, sizeof(indent), "%s      ", pad);
+        write_update_call(out, ext, indent, "step");
+        fprintf(out, "%s      s_%s_accumulator -= step;\n", pad, state_name(ext));
+        fprintf(out, "%s    }\n", pad);
+        fprintf(out, "%s  }\n", pad);
+      } else {
+        snprintf(indent, sizeof(indent), "%s  ", pad);
+        write_update_call(out, ext, indent, "dt");
+      }
+
+      if (ext->lazy) {
+        fprintf(out, "  }\n");
+      }
+    }
+
+    fprintf(out, "}\n\n");
+  }
+
+  fprintf(out, "#endif // EXTENSION_DISPATCH_GENERATED_H\n");
+  fclose(out);
+  return 1;
+}
+
+// Scan every .c file in one extension directory
+static int scan_directory(const char *source_dir) {
+  int found = 0;
+
+#ifdef _WIN32
+  WIN32_FIND_DATAA find_data;
+  char search_path[MAX_PATH];
+  snprintf(search_path, sizeof(search_path), "%s\\*.c", source_dir);
+
+  HANDLE hFind = FindFirstFileA(search_path, &find_data);
+  if (hFind == INVALID_HANDLE_VALUE) {
+    fprintf(stderr, "Error: Could not open directory: %s\n", source_dir);
+    return -1;
+  }
+
+  do {
+    if (find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+      continue;
+    }
+
+    char filepath[MAX_PATH];
+    snprintf(filepath, sizeof(filepath), "%s\\%s", source_dir, find_data.cFileName);
+    found += scan_source_file(filepath);
+  } while (FindNextFileA(hFind, &find_data) != 0);
+
+  FindClose(hFind);
+#else
+  DIR *dir = opendir(source_dir);
+  if (!dir) {
+    fprintf(stderr, "Error: Could not open directory: %s\n", source_dir);
+    return -1;
+  }
+
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != NULL) {
+    const char *name = entry->d_name;
+    size_t len = strlen(name);
+
+    // Only process .c files
+    if (len < 3 || strcmp(name + len - 2, ".c") != 0)
+      continue;
+
+    char filepath[1024];
+    snprintf(filepath, sizeof(filepath), "%s/%s", source_dir, name);
+    found += scan_source_file(filepath);
+  }
+
+  closedir(dir);
+#endif
+
+  return found;
+}
+
+int main(int argc, char **argv) {
+  setbuf(stdout, NULL);
+  if (argc < 3) {
+    fprintf(stderr, "Usage: manifest_gen <manifest_header> <dispatch_header> [extension_dir...]\n");
+    fprintf(stderr, "Scans each extension directory for ExtensionInterface definitions\n");
+    fprintf(stderr, "and generates the extension manifest and static dispatch headers.\n");
+    fprintf(stderr, "Example:\n");
+    fprintf(stderr, "  manifest_gen shared/include/extension_manifest_generated.h \\\n");
+    fprintf(stderr, "               shared/include/extension_dispatch_generated.h extensions/test\n");
+    return 1;
+  }
+
+  const char *manifest_file = argv[1];
+  const char *dispatch_file = argv[2];
+
+  for (int i = 3; i < argc; i++) {
+    int found = scan_directory(argv[i]);
+    if (found < 0)
+      return 1;
+    printf("  %s: %d extensions\n", argv[i], found);
+  }
+
+  // Registration order: the same however the directories were listed
+  qsort(g_extensions, (size_t)g_extension_count, sizeof(ExtensionDecl), compare_extensions);
+
+  for (int i = 0; i < g_extension_count; i++) {
+    build_id(&g_extensions[i]);
+    for (int j = 0; j < i; j++) {
+      if (strcmp(g_extensions[j].id, g_extensions[i].id) == 0) {
+        fprintf(stderr, "Error: %s and %s both map to %s\n",
+                g_extensions[j].variable, g_extensions[i].variable, g_extensions[i].id);
+        return 1;
+      }
+    }
+  }
+
+  for (int i = 0; i < g_extension_count; i++) {
+    const ExtensionDecl *ext = &g_extensions[i];
+    printf("  %s (%s): %s, %s, update %s%s\n", ext->variable, ext->id, g_phase_names[ext->phase], g_rate_names[ext->rate],
+           ext->update[0] ? ext->update : "(none)", ext->update_is_static ? " (static, via interface)" : "");
+  }
+
+  if (!generate_manifest_header(manifest_file) || !generate_dispatch_header(dispatch_file))
+    return 1;
+
+  printf("Generated %s\n", manifest_file);
+  printf("Generated %s\n", dispatch_file);
+  return 0;
+}